@@ -104,6 +104,11 @@ namespace lsp
             static constexpr float  REACT_TIME_DFL          = 0.200;
             static constexpr float  REACT_TIME_STEP         = 0.001;
 
+            static constexpr float  PROFILE_MIN             = 0.0f;     // Profiling: cycles per sample
+            static constexpr float  PROFILE_MAX             = 1000000.0f;
+            static constexpr float  PROFILE_DFL             = 0.0f;
+            static constexpr float  PROFILE_STEP            = 1.0f;
+
             static constexpr size_t FFT_RANK                = 13;
             static constexpr size_t FFT_ITEMS               = 1 << FFT_RANK;
             static constexpr size_t FFT_MESH_POINTS         = 640;
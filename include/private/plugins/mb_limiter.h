@@ -32,10 +32,21 @@
 #include <lsp-plug.in/dsp-units/util/Dither.h>
 #include <lsp-plug.in/dsp-units/util/FFTCrossover.h>
 #include <lsp-plug.in/dsp-units/util/Oversampler.h>
+#include <lsp-plug.in/ipc/ITask.h>
+#include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/plug-fw/core/IDBuffer.h>
 #include <lsp-plug.in/plug-fw/plug.h>
 
 #include <private/meta/mb_limiter.h>
+#include <private/util/AnalysisQueue.h>
+#include <private/util/ParamQueue.h>
+#include <private/util/Semaphore.h>
+#include <private/util/TaskPool.h>
+#include <private/util/Worker.h>
+
+#ifdef LSP_INSTRUMENT
+    #include <private/util/EventTrace.h>
+#endif /* LSP_INSTRUMENT */
 
 namespace lsp
 {
@@ -60,6 +71,33 @@ namespace lsp
                     XOVER_LINEAR_PHASE
                 };
 
+                enum xover_flags_t
+                {
+                    XF_VALID            = 1 << 0,           // Crossover filters of the band have been designed
+                    XF_FIRST            = 1 << 1,           // The band is the first one in the plan
+                    XF_LAST             = 1 << 2,           // The band is the last one in the plan
+                    XF_LINEAR           = 1 << 3            // The band is designed for linear-phase crossover
+                };
+
+                enum resource_t
+                {
+                    RES_WORKER          = 1 << 0,           // Worker thread for parallel and pipelined processing
+                    RES_BAND_POOL       = 1 << 1,           // Shared threads for parallel processing of bands
+                    RES_ANALYSIS        = 1 << 2,           // Analysis thread
+                    RES_PIPELINE        = 1 << 3            // Buffers for pipelined processing
+                };
+
+                enum channel_stage_t
+                {
+                    CS_VCA_GAIN,                            // Oversample and compute multiband VCA gain
+                    CS_APPLY_VCA,                           // Apply multiband VCA gain and compute single-band VCA gain
+                    CS_OUTPUT,                              // Apply single-band VCA gain and downsample
+                    CS_PIPELINE                             // Apply VCA gain to the previous buffer of all channels
+                };
+
+                // Routine that processes the buffer serially: oversamples, processes and downsamples all channels
+                typedef void (mb_limiter::*process_t)(size_t samples, size_t ovs_samples);
+
                 typedef struct premix_t
                 {
                     float                   fInToSc;            // Input -> Sidechain mix
@@ -86,16 +124,8 @@ namespace lsp
                     plug::IPort            *pScToLink;          // Sidechain -> Link mix
                 } premix_t;
 
-                typedef struct limiter_t
+                typedef struct limiter_ports_t
                 {
-                    dspu::Limiter           sLimit;             // Limiter
-
-                    bool                    bEnabled;           // Enabled flag
-                    float                   fStereoLink;        // Stereo linking
-                    float                   fInLevel;           // Input level
-                    float                   fReductionLevel;    // Gain reduction level
-                    float                  *vVcaBuf;            // Voltage-controlled amplification value for each band
-
                     plug::IPort            *pEnable;            // Enable
                     plug::IPort            *pAlrOn;             // Automatic level regulation
                     plug::IPort            *pAlrAttack;         // Automatic level regulation attack
@@ -110,36 +140,67 @@ namespace lsp
                     plug::IPort            *pRelease;           // Release time
                     plug::IPort            *pInMeter;           // Input gain meter
                     plug::IPort            *pStereoLink;        // Stereo linking
+                } limiter_ports_t;
+
+                typedef struct limiter_t
+                {
+                    bool                    bEnabled;           // Enabled flag
+                    float                   fStereoLink;        // Stereo linking
+                    float                   fInLevel;           // Input level
+                    float                   fReductionLevel;    // Gain reduction level
+                    float                  *vVcaBuf;            // Voltage-controlled amplification value for each band
+
+                    dspu::Limiter           sLimit;             // Limiter
+
                     plug::IPort            *pReductionMeter;    // Reduction gain meter
                 } limiter_t;
 
-                typedef struct band_t
+                /**
+                 * Ports of the band, they are shared by all channels
+                 */
+                typedef struct band_ports_t
                 {
-                    dspu::Equalizer         sEq;                // Sidechain equalizer
+                    limiter_ports_t         sLimiter;           // Ports of the limiter
+
+                    plug::IPort            *pFreqEnd;           // Frequency range end
+                    plug::IPort            *pSolo;              // Solo switch
+                    plug::IPort            *pMute;              // Mute switch
+                    plug::IPort            *pPreamp;            // Sidechain preamp
+                    plug::IPort            *pMakeup;            // Band makeup
+                    plug::IPort            *pBandGraph;         // Frequency band filter graph
+                } band_ports_t;
+
+                /**
+                 * Band processor, the data accessed by the band loops for each buffer goes first,
+                 * the data used only when settings change goes last. Each band starts at the
+                 * cache line, so the data of the band loops does not share the line with the
+                 * cold data of the previous band
+                 */
+                typedef struct alignas(OPTIMAL_ALIGN) band_t
+                {
+                    bool                    bMute;              // Mute channel
+                    bool                    bEnabled;           // Band is enabled
+                    float                   fPreamp;            // Sidechain pre-amplification
+                    float                   fMakeup;            // Makeup gain
+                    float                  *vVcaGain;           // VCA gain applied to the signal, differs from sLimiter.vVcaBuf in pipelined mode
+                    float                  *vPipeVcaBuf;        // Second VCA buffer for pipelined mode
+                    float                  *vDataBuf;           // Data buffer
+
+                    limiter_t               sLimiter;           // Limiter
+
                     dspu::Filter            sPassFilter;        // Passing filter for 'classic' mode
                     dspu::Filter            sRejFilter;         // Rejection filter for 'classic' mode
                     dspu::Filter            sAllFilter;         // All-pass filter for phase compensation
-
-                    limiter_t               sLimiter;           // Limiter
+                    dspu::Equalizer         sEq;                // Sidechain equalizer
 
                     bool                    bSync;              // Synchronization request
-                    bool                    bMute;              // Mute channel
                     bool                    bSolo;              // Solo channel
-                    bool                    bEnabled;           // Band is enabled
-                    float                   fPreamp;            // Sidechain pre-amplification
                     float                   fFreqStart;         // Start frequency of the band
                     float                   fFreqEnd;           // End frequency of the band
-                    float                   fMakeup;            // Makeup gain
-
-                    float                  *vDataBuf;           // Data buffer
+                    float                   fXoverStart;        // Start frequency the crossover filters are designed for
+                    float                   fXoverEnd;          // End frequency the crossover filters are designed for
+                    uint32_t                nXoverFlags;        // Position in the plan the crossover filters are designed for
                     float                  *vTrOut;             // Transfer function output
-
-                    plug::IPort            *pFreqEnd;           // Frequency range end
-                    plug::IPort            *pSolo;              // Solo switch
-                    plug::IPort            *pMute;              // Mute switch
-                    plug::IPort            *pPreamp;            // Sidechain preamp
-                    plug::IPort            *pMakeup;            // Band makeup
-                    plug::IPort            *pBandGraph;         // Frequency band filter graph
                 } band_t;
 
                 typedef struct split_t
@@ -151,8 +212,55 @@ namespace lsp
                     plug::IPort            *pFreq;              // Split frequency
                 } split_t;
 
+#ifdef LSP_INSTRUMENT
+                enum stage_t
+                {
+                    ST_PREMIX,
+                    ST_OVERSAMPLE,
+                    ST_VCA_GAIN,
+                    ST_STEREO_LINK,
+                    ST_APPLY_VCA,
+                    ST_SINGLE_BAND,
+                    ST_DOWNSAMPLE,
+                    ST_OUTPUT,
+                    ST_ANALYSIS,
+
+                    ST_TOTAL
+                };
+
+                typedef struct profile_t
+                {
+                    uint64_t                vStages[ST_TOTAL];  // Cycles spent in each stage of process()
+                    uint64_t                vBands[meta::mb_limiter::BANDS_MAX];    // Cycles spent for each band
+                    uint64_t                nCycles;            // Overall cycles spent in process()
+                    uint64_t                nSamples;           // Overall number of processed samples
+                    uint64_t                nCalls;             // Number of process() calls
+                    float                   fLoad;              // Cycles per sample for the last process() call
+                } profile_t;
+#endif /* LSP_INSTRUMENT */
+
+                /**
+                 * Channel processor, the data accessed for each buffer goes first
+                 */
                 typedef struct channel_t
                 {
+                    float                  *vIn;                // Input data
+                    float                  *vSc;                // Sidechain data
+                    float                  *vShmIn;             // Shared memory input
+                    float                  *vOut;               // Output data
+                    float                  *vData;              // Intermediate buffer with processed data
+                    float                  *vInBuf;             // Oversampled input data buffer
+                    float                  *vApplyBuf;          // Oversampled input data the VCA gain is applied to
+                    float                  *vPipeInBuf;         // Second input data buffer for pipelined mode
+                    float                  *vPipeOut;           // Output delay buffer for pipelined mode
+                    float                  *vScBuf;             // Oversampled sidechain data buffer
+                    float                  *vDataBuf;           // Oversampled buffer for processed data
+                    float                  *vTmpBuf;            // Temporary buffer
+                    float                  *vEnvBuf;            // Temporary envelope buffer
+                    band_t                 *vPlan[meta::mb_limiter::BANDS_MAX];     // Actual plan
+
+                    limiter_t               sLimiter;           // Output limiter
+
                     dspu::Bypass            sBypass;            // Bypass
                     dspu::FFTCrossover      sFFTXOver;          // FFT crossover
                     dspu::FFTCrossover      sFFTScXOver;        // FFT crossover for sidechain
@@ -165,17 +273,7 @@ namespace lsp
                     dspu::Delay             sDryDelay;          // Dry delay
 
                     band_t                  vBands[meta::mb_limiter::BANDS_MAX];    // Band processors
-                    band_t                 *vPlan[meta::mb_limiter::BANDS_MAX];     // Actual plan
-                    limiter_t               sLimiter;           // Output limiter
 
-                    float                  *vIn;                // Input data
-                    float                  *vSc;                // Sidechain data
-                    float                  *vShmIn;             // Shared memory input
-                    float                  *vOut;               // Output data
-                    float                  *vData;              // Intermediate buffer with processed data
-                    float                  *vInBuf;             // Oversampled input data buffer
-                    float                  *vScBuf;             // Oversampled sidechain data buffer
-                    float                  *vDataBuf;           // Oversampled buffer for processed data
                     float                  *vTrOut;             // Transfer function output
                     bool                    bFftIn;             // Output input FFT analysis
                     bool                    bFftOut;            // Output output FFT analysis
@@ -195,14 +293,84 @@ namespace lsp
                     plug::IPort            *pFilterGraph;       // Output filter graph
                 } channel_t;
 
+                /**
+                 * Offline task that allocates resources requested by the DSP thread. The task
+                 * is detached from the plugin when the plugin is destroyed while the task is
+                 * still queued, the executor may run it later or never
+                 */
+                class ResourceTask: public ipc::ITask
+                {
+                    private:
+                        enum state_t
+                        {
+                            RT_ATTACHED,                        // The task may run for the plugin
+                            RT_RUNNING,                         // The task allocates resources of the plugin
+                            RT_DETACHED                         // The plugin has been destroyed
+                        };
+
+                    private:
+                        mb_limiter             *pPlugin;
+                        uatomic_t               nState;
+
+                    public:
+                        explicit ResourceTask(mb_limiter *plugin);
+                        ResourceTask(const ResourceTask &) = delete;
+                        ResourceTask(ResourceTask &&) = delete;
+                        virtual ~ResourceTask() override;
+
+                        ResourceTask & operator = (const ResourceTask &) = delete;
+                        ResourceTask & operator = (ResourceTask &&) = delete;
+
+                    public:
+                        virtual status_t        run() override;
+
+                    public:
+                        /**
+                         * Detach the queued task from the plugin, should be called when the task
+                         * is neither idle nor completed
+                         * @return true if the task has been detached, false if the task is running
+                         */
+                        bool                    detach();
+                };
+
             protected:
-                dspu::Analyzer          sAnalyzer;          // Analyzer
+                dspu::Analyzer          sAnalyzer;          // Analyzer, shared with the analysis thread
+                SampleRing              sAnRing;            // Samples passed to the analysis thread
+                FrameBuffer             sAnSpectrum;        // Spectrums computed by the analysis thread
+                ipc::Thread            *pAnThread;          // Analysis thread
+                uatomic_t               nAnLock;            // Analyzer is owned by one of threads
+                uatomic_t               nAnShutdown;        // Shutdown request for the analysis thread
+                Semaphore               sAnWake;            // Wakes up the analysis thread
+                size_t                  nAnSamples;         // Number of samples passed since the analysis thread has been woken up
+                size_t                  nAnPeriod;          // Minimum number of samples between wake-ups of the analysis thread
                 dspu::Counter           sCounter;           // Sync counter
+                ParamQueue              sEvents;            // Queue of timestamped parameter changes
+                lltl::parray<ParamPort> vParamPorts;        // Shadows of parameters that support timestamped changes
+                uint64_t                nFrame;             // Position of the processed data in the stream
                 premix_t                sPremix;            // Premix
+                Worker                  sWorker;            // Worker for parallel processing of the second channel
+                TaskPool                sBandPool;          // Client of the shared thread pool for parallel processing of bands
+                ResourceTask           *pResTask;           // Offline task that allocates resources
+                uatomic_t               nResRequest;        // Resources requested by the DSP thread
+                uatomic_t               nResTried;          // Resources the task has tried to allocate
+                uatomic_t               nResources;         // Resources available to the DSP thread
+                uint32_t                nResApplied;        // Resources the actual settings are based on
                 uint32_t                nChannels;          // Number of channels
+                uint32_t                nStreams;           // Number of streams processed by process_bank()
+                uint32_t                nStates;            // Number of channel states: channels of ports and streams of the bank
                 xover_mode_t            nMode;              // Operating mode
                 bool                    bSidechain;         // Sidechain switch is present
+                bool                    bParallel;          // Parallel processing of channels
+                bool                    bBandParallel;      // Parallel processing of bands
+                bool                    bPipeline;          // Pipelined processing
+                bool                    bTiled;             // Cache-blocked processing of bands
+                bool                    bParallelReq;       // Parallel processing of channels is switched on
+                bool                    bBandParallelReq;   // Parallel processing of bands is switched on
+                bool                    bPipelineReq;       // Pipelined processing is switched on
+                bool                    bTiledReq;          // Cache-blocked processing is switched on
                 bool                    bEnvUpdate;         // Request for envelope update
+                bool                    bAnUpdate;          // Request for analyzer update
+                bool                    bAnActive;          // Analysis is active
                 uint32_t                nScMode;            // Sidechain mode
                 float                   fInGain;            // Input gain
                 float                   fOutGain;           // Output gain
@@ -210,20 +378,35 @@ namespace lsp
                 uint32_t                nRealSampleRate;    // Real sample rate
                 uint32_t                nEnvBoost;          // Envelope boosting
                 uint32_t                nLookahead;         // Lookahead buffer size
+                size_t                  nStageSamples;      // Number of samples for the parallel stage
+                size_t                  nStageOvsSamples;   // Number of oversampled samples for the parallel stage
+                ssize_t                 nPhaseSlot;         // Slot in the registry of FFT frame phases
+                channel_t              *pBandChannel;       // Channel which bands are processed in parallel
+                size_t                  nBandSamples;       // Number of samples for parallel processing of bands
+                size_t                  nPipeSamples;       // Number of samples of the buffer pending in the pipeline
+                size_t                  nPipeOvsSamples;    // Number of oversampled samples of the buffer pending in the pipeline
+                size_t                  nPipeFill;          // Number of samples in the output delay buffers
+                size_t                  nTileSize;          // Number of oversampled samples in the tile of cache-blocked processing
+                size_t                  nTileRequest;       // Tile size requested by set_tile_size(), 0 for automatic selection
+                size_t                  nCacheSize;         // Size of the L1 data cache
 
                 channel_t              *vChannels;          // Channels
-                float                  *vTmpBuf;            // Temporary buffer
-                float                  *vEnvBuf;            // Temporary envelope buffer
                 uint32_t               *vIndexes;           // Analyzer FFT indexes
                 float                  *vFreqs;             // Analyzer FFT frequencies
                 float                  *vTr;                // Buffer for computing transfer function
                 float                  *vTrTmp;             // Temporary buffer for computing transfer function
                 float                  *vFc;                // Filter characteristics
+                float                  *vAnBuf;             // Buffer of the analysis thread
+                float                  *vMbLinkBuf;         // Temporary buffer for stereo linking of bands
+                float                  *vSbLinkBuf;         // Temporary buffer for stereo linking of the output limiter
                 core::IDBuffer         *pIDisplay;          // Inline display buffer
 
                 split_t                 vSplits[meta::mb_limiter::BANDS_MAX-1];     // Frequency splits
+                limiter_ports_t         sLimiterPorts;      // Ports of the output limiter
+                band_ports_t            vBandPorts[meta::mb_limiter::BANDS_MAX];    // Ports of bands
                 uint8_t                 vPlan[meta::mb_limiter::BANDS_MAX];         // Execution plan (band indices)
                 size_t                  nPlanSize;          // Plan size
+                process_t               pProcess;           // Serial processing routine specialized for the configuration
 
                 plug::IPort            *pBypass;            // Bypass port
                 plug::IPort            *pInGain;            // Input gain
@@ -237,8 +420,21 @@ namespace lsp
                 plug::IPort            *pReactivity;        // Reactivity
                 plug::IPort            *pShift;             // Shift gain
                 plug::IPort            *pScMode;            // Sidechain mode
+                plug::IPort            *pParallel;          // Parallel processing of channels
+                plug::IPort            *pBandParallel;      // Parallel processing of bands
+                plug::IPort            *pPipeline;          // Pipelined processing
+                plug::IPort            *pTiled;             // Cache-blocked processing of bands
 
                 uint8_t                *pData;
+                uint8_t                *pPipeData;          // Buffers for pipelined processing, allocated on demand
+
+#ifdef LSP_INSTRUMENT
+                profile_t               sProfile;           // Profiling data
+                plug::IPort            *pProfile;           // Profiling meter
+                EventTrace              sTrace;             // Event trace
+                EventTraceWriter       *pTraceWriter;       // Offline task that writes event trace to file
+                ssize_t                 nTraceLatency;      // Last latency recorded to the trace
+#endif /* LSP_INSTRUMENT */
 
             protected:
                 dspu::over_mode_t       decode_oversampling_mode(size_t mode);
@@ -247,19 +443,63 @@ namespace lsp
                 void                    output_meters();
                 void                    output_fft_curves();
                 void                    perform_analysis(size_t samples);
+                bool                    configure_analyzer();
+                bool                    process_analysis();
+                status_t                run_analysis();
                 void                    oversample_data(size_t samples, size_t ovs_samples);
+                void                    oversample_channel(channel_t *c, size_t samples, size_t ovs_samples);
+                void                    compute_multiband_vca_gain(channel_t *c, size_t samples);
+                void                    compute_band_vca_gain(channel_t *c, band_t *b, size_t off, size_t samples);
+                void                    process_multiband_stereo_link(size_t off, size_t samples);
+                void                    apply_multiband_vca_gain(channel_t *c, size_t off, size_t samples);
+                template <sc_mode_t SC_MODE>
+                void                    oversample_channel(channel_t *c, size_t samples, size_t ovs_samples);
+                template <xover_mode_t XOVER>
                 void                    compute_multiband_vca_gain(channel_t *c, size_t samples);
-                void                    process_multiband_stereo_link(size_t samples);
-                void                    apply_multiband_vca_gain(channel_t *c, size_t samples);
+                template <xover_mode_t XOVER>
+                void                    compute_band_vca_gain(channel_t *c, band_t *b, size_t off, size_t samples);
+                template <xover_mode_t XOVER>
+                void                    apply_multiband_vca_gain(channel_t *c, size_t off, size_t samples);
+                template <size_t CHANNELS, xover_mode_t XOVER, sc_mode_t SC_MODE>
+                void                    process_buffer(size_t samples, size_t ovs_samples);
+                process_t               select_process() const;
                 void                    process_single_band(size_t samples);
+                void                    compute_single_band_vca_gain(channel_t *c, size_t off, size_t samples);
+                void                    process_single_band_stereo_link(size_t off, size_t samples);
+                void                    apply_single_band_vca_gain(channel_t *c, size_t off, size_t samples);
+                void                    process_tiled(channel_t *c, size_t channels, size_t samples);
+                size_t                  select_tile_size() const;
                 void                    downsample_data(size_t samples);
-                void                    perform_stereo_link(float *cl, float *cr, float link, size_t samples);
+                void                    downsample_channel(channel_t *c, size_t samples);
+                void                    process_channel_stage(channel_t *c, size_t stage);
+                void                    process_channels_parallel(size_t stage);
+                void                    process_pipeline();
+                void                    advance_pipeline(size_t samples, size_t ovs_samples);
+                void                    flush_pipeline();
+                void                    reset_pipeline();
                 void                    output_audio(size_t samples);
+                void                    schedule_analysis(size_t samples);
+                void                    request_resources();
+                void                    sync_resources();
+                void                    update_modes();
+                size_t                  apply_events(size_t samples);
+                void                    apply_param(plug::IPort *port);
+                void                    wrap_param(plug::IPort **port);
+                void                    wrap_limiter_params(limiter_ports_t *p);
+                void                    configure_limiter(limiter_t *l, const limiter_ports_t *p);
+                void                    update_band_gains(band_t *b, const band_ports_t *p);
+                void                    update_output_gain();
 
                 size_t                  decode_real_sample_rate(size_t mode);
                 uint32_t                decode_sidechain_mode(uint32_t sc) const;
 
+                void                    invalidate_bands();
+                void                    update_fft_phase(channel_t *c, size_t index);
                 void                    do_destroy();
+            #ifdef LSP_INSTRUMENT
+                void                    init_trace();
+                void                    flush_trace();
+            #endif /* LSP_INSTRUMENT */
 
             protected:
                 static dspu::limiter_mode_t     decode_limiter_mode(ssize_t mode);
@@ -268,11 +508,35 @@ namespace lsp
                 static size_t                   select_fft_rank(size_t sample_rate);
                 static void                     process_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count);
                 static void                     process_sc_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count);
+                static void                     process_channel_job(void *object, size_t stage);
+                static void                     process_band_job(void *object, size_t index);
+                static status_t                 analysis_thread_proc(void *arg);
 
+                static bool                     is_limiter_port(const limiter_ports_t *p, const plug::IPort *port);
+                static void                     init_limiter_ports(limiter_ports_t *p);
                 static void                     dump(dspu::IStateDumper *v, const char *name, const limiter_t *l);
+                static void                     dump(dspu::IStateDumper *v, const char *name, const limiter_ports_t *p);
+
+            public:
+                /**
+                 * Link VCA gains of two channels: the gain of the channel with lower gain stays
+                 * the same, the higher gain is moved towards the lower one
+                 * @param cl VCA gain of the left channel
+                 * @param cr VCA gain of the right channel
+                 * @param buf temporary buffer of at least 2*samples elements
+                 * @param link stereo link value in range [0, 1]
+                 * @param samples number of samples to process
+                 */
+                static void                     perform_stereo_link(float *cl, float *cr, float *buf, float link, size_t samples);
 
             public:
-                explicit mb_limiter(const meta::plugin_t *meta);
+                /**
+                 * Create plugin
+                 * @param meta plugin metadata
+                 * @param streams number of independent streams processed by process_bank(),
+                 *   only the mono version without sidechain supports more than one stream
+                 */
+                explicit mb_limiter(const meta::plugin_t *meta, size_t streams = 1);
                 mb_limiter(const mb_limiter &) = delete;
                 mb_limiter(mb_limiter &&) = delete;
                 virtual ~mb_limiter() override;
@@ -290,6 +554,79 @@ namespace lsp
                 virtual void            ui_activated() override;
                 virtual bool            inline_display(plug::ICanvas *cv, size_t width, size_t height) override;
                 virtual void            dump(dspu::IStateDumper *v) const override;
+
+            public:
+                /**
+                 * Allocate resources requested by the DSP thread for the enabled processing modes
+                 * and the analyzer: start worker threads, the analysis thread, connect to the shared
+                 * thread pool and allocate buffers for pipelined processing. Resources are never
+                 * released until the plugin is destroyed. Not real-time safe, the plugin calls
+                 * it by the offline task in the executor of the wrapper, hosts without executor
+                 * should call it between process() calls. The DSP thread applies the new resources
+                 * at the start of the next process() call.
+                 * @return true if any resource has been requested
+                 */
+                bool                            update_resources();
+
+                /**
+                 * Get number of streams processed by process_bank()
+                 * @return number of streams, zero if the plugin does not support processing of streams
+                 */
+                inline size_t                   streams() const         { return nStreams; }
+
+                /**
+                 * Process the bank of independent mono streams with the same settings. Each stream
+                 * has its own processing state, while settings, metering, FFT curves and the inline
+                 * display are handled once for the whole bank and reflect the first stream. The
+                 * sidechain, shared memory link and pre-mix are not available for streams.
+                 * @param in array of streams() pointers to input buffers
+                 * @param out array of streams() pointers to output buffers
+                 * @param samples number of samples to process
+                 */
+                void                            process_bank(const float * const *in, float * const *out, size_t samples);
+
+                /**
+                 * Get position of the processed data in the stream, it is advanced by process()
+                 * and process_bank() and is the time base of parameter changes
+                 * @return number of samples processed since the plugin has been initialized
+                 */
+                inline uint64_t                 frame() const           { return nFrame; }
+
+                /**
+                 * Set the size of the tile for cache-blocked processing of bands. The size is
+                 * rounded down to the multiple of 16 samples and limited to the range between 64
+                 * samples and the size of the oversampled buffer, the change takes effect at the
+                 * next update of settings
+                 * @param size number of oversampled samples in the tile, 0 for automatic selection
+                 *   according to the size of the L1 data cache and the number of active bands
+                 */
+                void                            set_tile_size(size_t size);
+
+                /**
+                 * Get the actual size of the tile for cache-blocked processing of bands
+                 * @return number of oversampled samples in the tile, zero if the cache-blocked
+                 *   processing is not active
+                 */
+                inline size_t                   tile_size() const       { return (bTiled) ? nTileSize : 0; }
+
+                /**
+                 * Post the change of the parameter that takes effect at the specified sample,
+                 * real-time safe and can be called from any thread. process() splits the
+                 * data at positions of changes and applies them between parts. Changes are
+                 * applied in the order they have been posted, the change with the position
+                 * in the past is applied at the start of the next process() call.
+                 *
+                 * The method is intended for hosts that drive the module directly (offline
+                 * renderers, test hosts), plugin format wrappers do not call it. Only input and
+                 * output gains, limiter parameters, preamp and makeup of bands are supported.
+                 * The posted value overrides the value of the port until the host changes it.
+                 * @param port control input port of the plugin
+                 * @param value new value of the port
+                 * @param frame position of the change in the stream, see frame()
+                 * @return true if the change has been posted, false if the port is not supported
+                 *   or the queue is full
+                 */
+                bool                            post_param(plug::IPort *port, float value, uint64_t frame);
         };
 
     } /* namespace plugins */
@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TEST_PLUGINHOST_H_
+#define PRIVATE_TEST_PLUGINHOST_H_
+
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Simple port implementation that stores the control value or
+         * audio buffer of the plugin without any host-side logic
+         */
+        class HostPort: public plug::IPort
+        {
+            protected:
+                float           fValue;
+                float          *pBuffer;
+
+            public:
+                explicit HostPort(const meta::port_t *meta);
+                HostPort(const HostPort &) = delete;
+                HostPort(HostPort &&) = delete;
+                virtual ~HostPort() override;
+
+                HostPort & operator = (const HostPort &) = delete;
+                HostPort & operator = (HostPort &&) = delete;
+
+                bool            init(size_t buffer_size);
+
+            public:
+                virtual float   value() override;
+                virtual void    set_value(float value) override;
+                virtual void   *buffer() override;
+        };
+
+        /**
+         * Minimal in-process host for the multiband limiter plugin. It instantiates
+         * the plugin module directly (no wrapper, no UI) and exposes ports by their
+         * identifiers which allows to drive the plugin from tests and tools.
+         */
+        class PluginHost
+        {
+            protected:
+                const meta::plugin_t           *pMeta;
+                plug::Module                   *pModule;
+                lltl::parray<HostPort>          vPorts;
+                size_t                          nSampleRate;
+                size_t                          nMaxBlock;
+                bool                            bUpdate;
+
+            protected:
+                HostPort       *find_port(const char *id);
+
+            public:
+                PluginHost();
+                PluginHost(const PluginHost &) = delete;
+                PluginHost(PluginHost &&) = delete;
+                ~PluginHost();
+
+                PluginHost & operator = (const PluginHost &) = delete;
+                PluginHost & operator = (PluginHost &&) = delete;
+
+                /**
+                 * Instantiate the plugin
+                 * @param meta plugin metadata
+                 * @param sample_rate sample rate
+                 * @param max_block maximum number of samples passed to process() at once
+                 * @param streams number of streams processed by process_bank()
+                 * @return status of operation
+                 */
+                status_t        init(const meta::plugin_t *meta, size_t sample_rate, size_t max_block, size_t streams = 1);
+
+                /**
+                 * Create ports and call init() of the plugin without setting the sample rate
+                 * and activating it. Allows to measure the plugin initialization separately,
+                 * should be followed by the call of start()
+                 * @param meta plugin metadata
+                 * @param max_block maximum number of samples passed to process() at once
+                 * @param streams number of streams processed by process_bank()
+                 * @return status of operation
+                 */
+                status_t        create(const meta::plugin_t *meta, size_t max_block, size_t streams = 1);
+
+                /**
+                 * Set the sample rate and activate the plugin created by create()
+                 * @param sample_rate sample rate
+                 */
+                void            start(size_t sample_rate);
+
+                /**
+                 * Destroy the plugin and all allocated ports
+                 */
+                void            destroy();
+
+            public:
+                inline plug::Module            *module()               { return pModule;       }
+                inline const meta::plugin_t    *metadata() const       { return pMeta;         }
+                inline size_t                   sample_rate() const    { return nSampleRate;   }
+                inline size_t                   max_block() const      { return nMaxBlock;     }
+                inline size_t                   ports() const          { return vPorts.size(); }
+                inline HostPort                *port(size_t index)     { return vPorts.get(index); }
+
+                /**
+                 * Check that the plugin has port with specified identifier
+                 * @param id port identifier
+                 * @return true if port exists
+                 */
+                bool            has_port(const char *id);
+
+                /**
+                 * Set value of the control port, the settings of the plugin are updated
+                 * on the next call of process()
+                 * @param id port identifier
+                 * @param value value to set
+                 * @return true if port has been found
+                 */
+                bool            set(const char *id, float value);
+
+                /**
+                 * Set value of all control ports which identifiers start with the specified
+                 * prefix, useful for per-channel and per-band ports like 'ife_l', 'ife_r'
+                 * @param prefix port identifier prefix
+                 * @param value value to set
+                 * @return number of ports affected
+                 */
+                size_t          set_all(const char *prefix, float value);
+
+                /**
+                 * Get current value of the port
+                 * @param id port identifier
+                 * @return port value or 0.0f if port does not exist
+                 */
+                float           get(const char *id);
+
+                /**
+                 * Get audio buffer associated with the port
+                 * @param id port identifier
+                 * @return pointer to the audio buffer or NULL
+                 */
+                float          *buffer(const char *id);
+
+                /**
+                 * Copy the signal to all audio input ports of the plugin including sidechain
+                 * @param src source signal
+                 * @param count number of samples, should not exceed max_block
+                 * @return number of audio inputs filled
+                 */
+                size_t          fill_inputs(const float *src, size_t count);
+
+                /**
+                 * Reset all ports to their default values
+                 */
+                void            reset_ports();
+
+                /**
+                 * Change the sample rate of the plugin
+                 * @param sample_rate new sample rate
+                 */
+                void            set_sample_rate(size_t sample_rate);
+
+                /**
+                 * Force the call of update_settings() on the next process() call
+                 */
+                inline void     request_update()                { bUpdate = true;       }
+
+                /**
+                 * Check that settings have been changed and update_settings() is pending
+                 * @return true if update is pending
+                 */
+                inline bool     update_pending() const          { return bUpdate;       }
+
+                /**
+                 * Apply pending settings immediately
+                 */
+                void            update_settings();
+
+                /**
+                 * Allocate resources requested by the plugin like the executor of the wrapper
+                 * does, not real-time safe. Is called by process() and process_bank() before
+                 * processing, see plugins::mb_limiter::update_resources()
+                 * @return true if any resource has been requested
+                 */
+                bool            update_resources();
+
+                /**
+                 * Post the change of the control port that takes effect inside of the next
+                 * process() calls, see plugins::mb_limiter::post_param()
+                 * @param id port identifier
+                 * @param value value to set
+                 * @param offset position of the change relative to the start of the next process() call
+                 * @return true if the change has been posted, false if the port does not support timestamped changes
+                 */
+                bool            post(const char *id, float value, size_t offset);
+
+                /**
+                 * Process the data stored in the audio input buffers
+                 * @param samples number of samples to process, should not exceed max_block
+                 */
+                void            process(size_t samples);
+
+                /**
+                 * Process the bank of independent streams, see plugins::mb_limiter::process_bank()
+                 * @param in array of pointers to input buffers of streams
+                 * @param out array of pointers to output buffers of streams
+                 * @param samples number of samples to process, should not exceed max_block
+                 */
+                void            process_bank(const float * const *in, float * const *out, size_t samples);
+
+                /**
+                 * Get number of streams processed by process_bank()
+                 * @return number of streams
+                 */
+                size_t          streams() const;
+
+                /**
+                 * Set the size of the tile for cache-blocked processing of bands and request
+                 * the update of settings, see plugins::mb_limiter::set_tile_size()
+                 * @param size number of oversampled samples in the tile, 0 for automatic selection
+                 */
+                void            set_tile_size(size_t size);
+
+                /**
+                 * Get the actual size of the tile for cache-blocked processing of bands
+                 * @return number of oversampled samples in the tile, zero if the cache-blocked
+                 *   processing is not active
+                 */
+                size_t          tile_size() const;
+
+                /**
+                 * Get the latency reported by the plugin
+                 * @return latency in samples
+                 */
+                ssize_t         latency() const;
+        };
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_PLUGINHOST_H_ */
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+ */
+
+#ifndef PRIVATE_TEST_BATCH_H_
+#define PRIVATE_TEST_BATCH_H_
+
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+#include <private/test/render.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Single job of the batch render
+         */
+        typedef struct batch_job_t
+        {
+            char               *src;                // Path to the input file
+            char               *preset;             // Path to the preset or NULL for defaults
+            char               *dst;                // Path to the output file
+            size_t              sample_rate;        // Sample rate of the input file
+            size_t              channels;           // Number of channels of the input file
+            status_t            status;             // Result of rendering
+            bool                reused;             // The job has been rendered by the reused plugin instance
+            render_stats_t      stats;              // Rendering statistics
+        } batch_job_t;
+
+        /**
+         * Statistics of the batch render
+         */
+        typedef struct batch_stats_t
+        {
+            size_t              threads;            // Number of worker threads
+            size_t              jobs;               // Number of jobs
+            size_t              failed;             // Number of failed jobs
+            size_t              instances;          // Number of plugin instances created
+            size_t              reused;             // Number of jobs rendered by reused instances
+            size_t              stolen;             // Number of jobs stolen from other workers
+            double              seconds;            // Overall time spent
+        } batch_stats_t;
+
+        /**
+         * Multi-job batch renderer. Jobs are grouped by the plugin configuration
+         * (sample rate and number of channels) and distributed between workers, each
+         * worker takes jobs from its own queue and steals jobs from the tail of the
+         * longest queue of other workers when its own queue is empty. Each worker keeps
+         * a small cache of plugin instances and reuses them for jobs with the same
+         * configuration instead of creating new ones: the instance is flushed with
+         * silence for the time needed to settle its state. The input is streamed through
+         * the plugin block by block, so the memory does not depend on the file length.
+         */
+        class BatchRenderer
+        {
+            protected:
+                lltl::parray<batch_job_t>   vJobs;
+
+            public:
+                BatchRenderer();
+                BatchRenderer(const BatchRenderer &) = delete;
+                BatchRenderer(BatchRenderer &&) = delete;
+                ~BatchRenderer();
+
+                BatchRenderer & operator = (const BatchRenderer &) = delete;
+                BatchRenderer & operator = (BatchRenderer &&) = delete;
+
+            public:
+                /**
+                 * Add job to the batch
+                 * @param src path to the input file
+                 * @param preset path to the preset or NULL to use defaults
+                 * @param dst path to the output file
+                 * @return status of operation
+                 */
+                status_t            add(const char *src, const char *preset, const char *dst);
+
+                /**
+                 * Load jobs from the manifest. Each non-empty line not starting with '#'
+                 * contains the input file, the preset and the output file separated by
+                 * whitespaces. The preset '-' means default settings.
+                 *
+                 * @param path path to the manifest
+                 * @return status of operation
+                 */
+                status_t            load_manifest(const char *path);
+
+                /**
+                 * Remove all jobs
+                 */
+                void                clear();
+
+                /**
+                 * Render all jobs
+                 * @param threads number of worker threads
+                 * @param block_size size of block passed to process()
+                 * @param stats pointer to store the statistics, may be NULL
+                 * @return status of operation, failures of separate jobs are reported by jobs
+                 */
+                status_t            run(size_t threads, size_t block_size, batch_stats_t *stats);
+
+            public:
+                inline size_t               jobs() const        { return vJobs.size();      }
+                inline const batch_job_t   *job(size_t index)   { return vJobs.get(index);  }
+        };
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_BATCH_H_ */
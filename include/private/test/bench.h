@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TEST_BENCH_H_
+#define PRIVATE_TEST_BENCH_H_
+
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+
+#include <stdio.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Get current value of the monotonic clock
+         * @return time in seconds
+         */
+        double          precise_time();
+
+        /**
+         * Resource usage of the current process
+         */
+        typedef struct resource_usage_t
+        {
+            size_t          peak_rss;       // Peak resident set size in kilobytes
+            size_t          minor_faults;   // Page faults serviced without I/O
+            size_t          major_faults;   // Page faults that required I/O
+        } resource_usage_t;
+
+        /**
+         * Get resource usage of the current process, all fields are zero if not supported
+         * @param ru pointer to store the resource usage
+         */
+        void            get_resource_usage(resource_usage_t *ru);
+
+        /**
+         * Statistics of the measured timings
+         */
+        typedef struct time_stats_t
+        {
+            size_t          count;          // Number of samples
+            double          mean;           // Mean value
+            double          p50;            // Median
+            double          p99;            // 99th percentile
+            double          p999;           // 99.9th percentile
+            double          max;            // Maximum value
+        } time_stats_t;
+
+        /**
+         * Compute statistics of the measured timings
+         * @param stats pointer to store statistics
+         * @param samples array of measured values, sorted in place
+         * @param count number of measured values
+         */
+        void            compute_stats(time_stats_t *stats, double *samples, size_t count);
+
+        /**
+         * Machine-readable benchmark results: one CSV row per measured configuration,
+         * so different runs can be compared with common tools
+         */
+        class ResultWriter
+        {
+            protected:
+                FILE           *pFD;
+                char           *sPath;
+
+            public:
+                ResultWriter();
+                ResultWriter(const ResultWriter &) = delete;
+                ResultWriter(ResultWriter &&) = delete;
+                ~ResultWriter();
+
+                ResultWriter & operator = (const ResultWriter &) = delete;
+                ResultWriter & operator = (ResultWriter &&) = delete;
+
+            public:
+                /**
+                 * Create the result file and write the header
+                 * @param path path to the file
+                 * @param header comma-separated list of column names
+                 * @return status of operation
+                 */
+                status_t        open(const char *path, const char *header);
+
+                /**
+                 * Write a row
+                 * @param fmt printf-style format of the row without the line ending
+                 * @return status of operation
+                 */
+                status_t        write(const char *fmt, ...);
+
+                /**
+                 * Close the file
+                 */
+                void            close();
+
+                /**
+                 * Get the path to the file
+                 * @return path to the file
+                 */
+                inline const char  *path() const       { return sPath; }
+        };
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_BENCH_H_ */
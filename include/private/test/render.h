@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TEST_RENDER_H_
+#define PRIVATE_TEST_RENDER_H_
+
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+
+#include <private/test/PluginHost.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Statistics of the offline render
+         */
+        typedef struct render_stats_t
+        {
+            size_t          channels;           // Number of channels
+            size_t          sample_rate;        // Sample rate
+            size_t          frames;             // Number of frames written
+            size_t          latency;            // Latency compensated by the render
+            size_t          params;             // Number of preset parameters applied
+            double          seconds;            // Time spent for processing
+        } render_stats_t;
+
+        /**
+         * Parameters of the chunk-parallel offline render
+         */
+        typedef struct chunk_params_t
+        {
+            size_t          block_size;         // Size of block passed to process()
+            size_t          chunks;             // Number of chunks rendered concurrently
+            ssize_t         preroll;            // Pre-roll in samples, negative value for automatic selection
+            bool            verify;             // Compare the result with the serial render
+        } chunk_params_t;
+
+        /**
+         * Statistics of the chunk-parallel offline render
+         */
+        typedef struct chunk_stats_t
+        {
+            render_stats_t  render;             // Statistics of the chunked render
+            size_t          chunks;             // Number of chunks actually rendered
+            size_t          preroll;            // Pre-roll applied to each chunk except the first one
+            double          serial_seconds;     // Time spent for the serial render, 0 if not verified
+            float           seam_deviation;     // Maximum deviation from the serial render near seams
+            size_t          seam_position;      // Frame with the maximum deviation near seams
+            float           max_deviation;      // Maximum deviation from the serial render over the whole output
+        } chunk_stats_t;
+
+        /**
+         * Load the preset in the plain-text configuration format (res/doc/configs/*.cfg)
+         * and apply it to the plugin. Each non-empty line not starting with '#' has
+         * the form 'key = value' where value is 'true', 'false' or a number which may
+         * be followed by the 'db' suffix for gain values. Unknown parameters are ignored.
+         *
+         * @param host plugin host
+         * @param path path to the preset file
+         * @param applied number of parameters applied to the plugin, may be NULL
+         * @return status of operation
+         */
+        status_t        apply_preset(PluginHost *host, const char *path, size_t *applied);
+
+        /**
+         * Select the plugin metadata for the specified number of channels
+         * @param channels number of channels
+         * @return plugin metadata or NULL if not supported
+         */
+        const meta::plugin_t   *select_plugin(size_t channels);
+
+        /**
+         * Estimate the number of samples the configured plugin needs to settle the state
+         * after the change of the input: the latency plus ten time constants of the
+         * longest release time
+         *
+         * @param host plugin host
+         * @return number of samples
+         */
+        size_t          settle_time(PluginHost *host);
+
+        /**
+         * Render the audio file through the plugin with latency compensation: the output
+         * file has exactly the same length as the input file and is aligned with it.
+         *
+         * @param dst path to the output file
+         * @param src path to the input file
+         * @param preset path to the preset or NULL to use defaults
+         * @param block_size size of block passed to process()
+         * @param stats pointer to store the render statistics, may be NULL
+         * @return status of operation
+         */
+        status_t        render_file(const char *dst, const char *src, const char *preset,
+                                    size_t block_size, render_stats_t *stats);
+
+        /**
+         * Render the sample through the plugin with latency compensation: the output
+         * sample has exactly the same length as the input sample and is aligned with it.
+         *
+         * @param dst sample to store the output, will be re-initialized
+         * @param src source sample
+         * @param preset path to the preset or NULL to use defaults
+         * @param block_size size of block passed to process()
+         * @param stats pointer to store the render statistics, may be NULL
+         * @return status of operation
+         */
+        status_t        render_sample(dspu::Sample *dst, dspu::Sample *src, const char *preset,
+                                      size_t block_size, render_stats_t *stats);
+
+        /**
+         * Render the sample by splitting it into chunks which are processed concurrently
+         * by separate plugin instances. Each chunk except the first one is preceded by the
+         * pre-roll: the instance processes the input before the chunk boundary and drops the
+         * output, so the limiter release, the ALR envelope and the filter history settle to
+         * the same state as in the serial render. Chunk boundaries are aligned to the block
+         * size, so each instance observes the same block grid as the serial render does.
+         * The automatic pre-roll covers the latency and ten time constants of the longest
+         * release time set by the preset.
+         *
+         * @param dst sample to store the output, will be re-initialized
+         * @param src source sample
+         * @param preset path to the preset or NULL to use defaults
+         * @param params parameters of the render
+         * @param stats pointer to store the render statistics, may be NULL
+         * @return status of operation
+         */
+        status_t        render_sample_chunked(dspu::Sample *dst, dspu::Sample *src, const char *preset,
+                                              const chunk_params_t *params, chunk_stats_t *stats);
+
+        /**
+         * Render the audio file using the chunk-parallel render, see render_sample_chunked()
+         *
+         * @param dst path to the output file
+         * @param src path to the input file
+         * @param preset path to the preset or NULL to use defaults
+         * @param params parameters of the render
+         * @param stats pointer to store the render statistics, may be NULL
+         * @return status of operation
+         */
+        status_t        render_file_chunked(const char *dst, const char *src, const char *preset,
+                                            const chunk_params_t *params, chunk_stats_t *stats);
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_RENDER_H_ */
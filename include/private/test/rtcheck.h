@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TEST_RTCHECK_H_
+#define PRIVATE_TEST_RTCHECK_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Real-time safety checker. When the checker is armed for the current thread,
+         * any call to the memory allocator (malloc/free/new/delete and friends), blocking
+         * pthread primitives or blocking system calls made by this thread is recorded
+         * as a violation. Other threads are not affected.
+         *
+         * Interposition is available only for Linux with GNU libc. Calls made from inside
+         * libc without passing through the PLT can not be caught.
+         */
+        enum rt_violation_t
+        {
+            RT_ALLOC,               // Memory allocation or deallocation
+            RT_LOCK,                // Blocking synchronization primitive
+            RT_SYSCALL,             // Blocking system call
+
+            RT_TOTAL
+        };
+
+        /**
+         * Check that the real-time safety checker is supported on this platform
+         * @return true if supported
+         */
+        bool            rt_check_supported();
+
+        /**
+         * Reset statistics of the checker
+         */
+        void            rt_check_reset();
+
+        /**
+         * Arm the checker for the current thread
+         * @param context the name of the checked code section, reported with the first violation
+         */
+        void            rt_check_begin(const char *context);
+
+        /**
+         * Disarm the checker for the current thread
+         */
+        void            rt_check_end();
+
+        /**
+         * Get number of violations since last reset
+         * @param type type of violation or RT_TOTAL for all violations
+         * @return number of violations
+         */
+        size_t          rt_check_violations(rt_violation_t type = RT_TOTAL);
+
+        /**
+         * Get description of the first violation since last reset
+         * @return description of the first violation or empty string
+         */
+        const char     *rt_check_first_violation();
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_RTCHECK_H_ */
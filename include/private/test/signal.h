@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TEST_SIGNAL_H_
+#define PRIVATE_TEST_SIGNAL_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Kind of the synthetic test signal
+         */
+        enum signal_kind_t
+        {
+            SIG_NOISE,              // White noise
+            SIG_SWEEP,              // Logarithmic sine sweep
+            SIG_TRANSIENTS,         // Decaying bursts with sharp attacks
+            SIG_CORPUS,             // All signals above concatenated
+
+            SIG_TOTAL
+        };
+
+        /**
+         * Get the name of the signal
+         * @param kind signal kind
+         * @return signal name
+         */
+        const char     *signal_name(signal_kind_t kind);
+
+        /**
+         * Generate white noise. The generator is fully deterministic: the same seed
+         * always produces the same sequence on every platform.
+         *
+         * @param dst destination buffer
+         * @param count number of samples
+         * @param seed random seed
+         * @param amplitude peak amplitude
+         */
+        void            generate_noise(float *dst, size_t count, uint32_t seed, float amplitude);
+
+        /**
+         * Generate logarithmic sine sweep from 20 Hz to 20 kHz
+         * @param dst destination buffer
+         * @param count number of samples
+         * @param sample_rate sample rate
+         * @param amplitude peak amplitude
+         */
+        void            generate_sweep(float *dst, size_t count, size_t sample_rate, float amplitude);
+
+        /**
+         * Generate transient-heavy material: periodic bursts with instant attack
+         * and exponential decay of different pitch and level
+         * @param dst destination buffer
+         * @param count number of samples
+         * @param sample_rate sample rate
+         * @param seed random seed
+         * @param amplitude peak amplitude
+         */
+        void            generate_transients(float *dst, size_t count, size_t sample_rate, uint32_t seed, float amplitude);
+
+        /**
+         * Generate the test signal of specified kind
+         * @param kind kind of signal
+         * @param dst destination buffer
+         * @param count number of samples
+         * @param sample_rate sample rate
+         * @param seed random seed
+         */
+        void            generate_signal(signal_kind_t kind, float *dst, size_t count, size_t sample_rate, uint32_t seed);
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_SIGNAL_H_ */
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_UTIL_ANALYSISQUEUE_H_
+#define PRIVATE_UTIL_ANALYSISQUEUE_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Fixed-size lock-free single-producer single-consumer ring of multichannel
+         * audio samples. The DSP thread writes samples with write() which never blocks
+         * nor allocates: samples that do not fit into the ring are dropped and counted.
+         * The consumer thread reads samples with read().
+         */
+        class SampleRing
+        {
+            protected:
+                float                  *vData;          // Ring buffers of all lanes
+                size_t                  nLanes;         // Number of lanes (channels)
+                uint32_t                nCapacity;      // Capacity of the ring in samples, power of 2
+                uatomic_t               nHead;          // Write position (producer)
+                uatomic_t               nTail;          // Read position (consumer)
+                uatomic_t               nDropped;       // Number of dropped samples
+
+            public:
+                SampleRing();
+                SampleRing(const SampleRing &) = delete;
+                SampleRing(SampleRing &&) = delete;
+                ~SampleRing();
+
+                SampleRing & operator = (const SampleRing &) = delete;
+                SampleRing & operator = (SampleRing &&) = delete;
+
+                /**
+                 * Allocate the ring
+                 * @param lanes number of lanes
+                 * @param capacity minimum number of samples per lane, rounded up to the power of 2
+                 * @return status of operation
+                 */
+                status_t        init(size_t lanes, size_t capacity);
+
+                /**
+                 * Free the ring
+                 */
+                void            destroy();
+
+            public:
+                /**
+                 * Get number of lanes
+                 * @return number of lanes
+                 */
+                inline size_t   lanes() const           { return nLanes;        }
+
+                /**
+                 * Get capacity of the ring
+                 * @return capacity of the ring in samples
+                 */
+                inline size_t   capacity() const        { return nCapacity;     }
+
+                /**
+                 * Write samples to the ring, real-time safe
+                 * @param src array of pointers to source buffers for each lane, NULL pointer
+                 *   means silence for the corresponding lane
+                 * @param count number of samples to write
+                 * @return number of samples written, the rest has been dropped
+                 */
+                size_t          write(const float * const *src, size_t count);
+
+                /**
+                 * Read samples from the ring
+                 * @param dst array of pointers to destination buffers for each lane
+                 * @param count maximum number of samples to read
+                 * @return number of samples read
+                 */
+                size_t          read(float * const *dst, size_t count);
+
+                /**
+                 * Get number of samples pending for read
+                 * @return number of pending samples
+                 */
+                size_t          pending();
+
+                /**
+                 * Get number of samples that can be written without dropping
+                 * @return number of free samples
+                 */
+                size_t          space();
+
+                /**
+                 * Get number of dropped samples
+                 * @return number of dropped samples
+                 */
+                size_t          dropped();
+        };
+
+        /**
+         * Lock-free triple buffer for passing fixed-size frames of data from one thread
+         * to another. The producer fills the back buffer and publishes it, the consumer
+         * always gets the most recently published frame. Neither side ever waits.
+         */
+        class FrameBuffer
+        {
+            protected:
+                float                  *vData;          // Data of all three buffers
+                size_t                  nSize;          // Size of the frame
+                uint32_t                nBack;          // Index of the buffer owned by producer
+                uint32_t                nFront;         // Index of the buffer owned by consumer
+                uatomic_t               nMiddle;        // Index of the shared buffer and the 'fresh' flag
+
+            public:
+                FrameBuffer();
+                FrameBuffer(const FrameBuffer &) = delete;
+                FrameBuffer(FrameBuffer &&) = delete;
+                ~FrameBuffer();
+
+                FrameBuffer & operator = (const FrameBuffer &) = delete;
+                FrameBuffer & operator = (FrameBuffer &&) = delete;
+
+                /**
+                 * Allocate buffers, all frames are initially filled with zeros
+                 * @param size size of the frame
+                 * @return status of operation
+                 */
+                status_t        init(size_t size);
+
+                /**
+                 * Free buffers
+                 */
+                void            destroy();
+
+            public:
+                /**
+                 * Get size of the frame
+                 * @return size of the frame
+                 */
+                inline size_t   size() const            { return nSize;         }
+
+                /**
+                 * Get the frame for writing, producer side
+                 * @return pointer to the frame
+                 */
+                float          *back();
+
+                /**
+                 * Publish the frame returned by back(), producer side
+                 */
+                void            publish();
+
+                /**
+                 * Get the most recently published frame, consumer side
+                 * @return pointer to the frame
+                 */
+                const float    *front();
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_UTIL_ANALYSISQUEUE_H_ */
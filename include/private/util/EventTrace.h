@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_UTIL_EVENTTRACE_H_
+#define PRIVATE_UTIL_EVENTTRACE_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/ipc/ITask.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Type of the traced event
+         */
+        enum trace_event_t
+        {
+            TE_SAMPLE_RATE,         // Sample rate has changed, arg = sample rate
+            TE_PLAN_REBUILD,        // Band plan has been rebuilt, arg = plan size
+            TE_DELAY_CLEAR,         // Delay lines have been cleared, arg = delay_clear_t mask
+            TE_XOVER_RESET,         // FFT crossovers have been cleared or re-initialized, arg = FFT rank
+            TE_OVERSAMPLER,         // Oversampler has been reconfigured, arg = oversampling mode
+            TE_LATENCY,             // Reported latency has changed, arg = latency in samples
+            TE_OVERRUN,             // Block processing took more time than real time, arg = time in microseconds
+
+            TE_TOTAL
+        };
+
+        /**
+         * Delay lines affected by the TE_DELAY_CLEAR event
+         */
+        enum trace_delay_t
+        {
+            TD_DATA_MB      = 1 << 0,       // Multiband data delay
+            TD_DATA_SB      = 1 << 1,       // Single-band data delay
+            TD_DRY          = 1 << 2        // Dry signal delay
+        };
+
+        /**
+         * Compact binary trace record
+         */
+        typedef struct trace_record_t
+        {
+            uint64_t        nBlock;         // Index of the process() call
+            uint64_t        nSample;        // Position of the block in the stream
+            uint32_t        nType;          // Event type
+            uint32_t        nArg;           // Event argument
+        } trace_record_t;
+
+        /**
+         * Fixed-size lock-free single-producer single-consumer ring of trace records.
+         * The DSP thread records events with record() which never blocks nor allocates:
+         * if the ring is full, the record is dropped and counted. Any other thread may
+         * drain the ring with read() or write the records to a file with drain().
+         */
+        class EventTrace
+        {
+            protected:
+                trace_record_t         *vRecords;       // Ring buffer
+                uint32_t                nCapacity;      // Capacity of the ring, power of 2
+                uatomic_t               nHead;          // Write position (producer)
+                uatomic_t               nTail;          // Read position (consumer)
+                uatomic_t               nDropped;       // Number of dropped records
+                uint64_t                nBlock;         // Current block
+                uint64_t                nSample;        // Current sample position
+
+            public:
+                EventTrace();
+                EventTrace(const EventTrace &) = delete;
+                EventTrace(EventTrace &&) = delete;
+                ~EventTrace();
+
+                EventTrace & operator = (const EventTrace &) = delete;
+                EventTrace & operator = (EventTrace &&) = delete;
+
+                /**
+                 * Allocate the ring
+                 * @param capacity minimum number of records, rounded up to the power of 2
+                 * @return status of operation
+                 */
+                status_t        init(size_t capacity);
+
+                /**
+                 * Free the ring
+                 */
+                void            destroy();
+
+            public:
+                /**
+                 * Mark start of the new block, should be called from the DSP thread
+                 */
+                inline void     begin_block()           { ++nBlock;             }
+
+                /**
+                 * Mark end of the block, should be called from the DSP thread
+                 * @param samples number of samples in the block
+                 */
+                inline void     end_block(size_t samples)   { nSample += samples;   }
+
+                /**
+                 * Record the event, real-time safe
+                 * @param type event type
+                 * @param arg event argument
+                 * @return true if the event has been recorded, false if the ring was full
+                 */
+                bool            record(trace_event_t type, uint32_t arg);
+
+                /**
+                 * Read records from the ring
+                 * @param dst destination buffer
+                 * @param count maximum number of records to read
+                 * @return number of records read
+                 */
+                size_t          read(trace_record_t *dst, size_t count);
+
+                /**
+                 * Get number of records pending for read
+                 * @return number of pending records
+                 */
+                size_t          pending();
+
+                /**
+                 * Get number of records dropped because of the ring overflow
+                 * @return number of dropped records
+                 */
+                size_t          dropped();
+
+                /**
+                 * Read all pending records and append them to the text file, not real-time safe
+                 * @param path path to the file
+                 * @return status of operation
+                 */
+                status_t        drain(const char *path);
+
+            public:
+                /**
+                 * Get the name of the event
+                 * @param type event type
+                 * @return name of the event
+                 */
+                static const char  *event_name(uint32_t type);
+        };
+
+        /**
+         * Offline task which drains the event trace to the file
+         */
+        class EventTraceWriter: public ipc::ITask
+        {
+            protected:
+                EventTrace             *pTrace;
+                char                   *sPath;
+
+            public:
+                explicit EventTraceWriter(EventTrace *trace);
+                EventTraceWriter(const EventTraceWriter &) = delete;
+                EventTraceWriter(EventTraceWriter &&) = delete;
+                virtual ~EventTraceWriter() override;
+
+                EventTraceWriter & operator = (const EventTraceWriter &) = delete;
+                EventTraceWriter & operator = (EventTraceWriter &&) = delete;
+
+                /**
+                 * Set the path to the output file, not real-time safe
+                 * @param path path to the output file
+                 * @return status of operation
+                 */
+                status_t        set_path(const char *path);
+
+                /**
+                 * Get the path to the output file
+                 * @return path to the output file or NULL
+                 */
+                inline const char  *path() const        { return sPath;         }
+
+            public:
+                virtual status_t    run() override;
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_UTIL_EVENTTRACE_H_ */
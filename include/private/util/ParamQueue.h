@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_UTIL_PARAMQUEUE_H_
+#define PRIVATE_UTIL_PARAMQUEUE_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Plugin-side shadow of the control port of the host. The plugin reads the parameter
+         * through the shadow, set_value() overrides the value of the host port without
+         * writing to it. The override is dropped by sync() as soon as the host changes the
+         * value of its port.
+         */
+        class ParamPort: public plug::IPort
+        {
+            protected:
+                plug::IPort            *pPort;          // Port of the host
+                float                   fValue;         // Overriding value
+                float                   fHost;          // Value of the host port when the override has been set
+                bool                    bOverride;      // The override is active
+
+            public:
+                explicit ParamPort(plug::IPort *port);
+                ParamPort(const ParamPort &) = delete;
+                ParamPort(ParamPort &&) = delete;
+                virtual ~ParamPort() override;
+
+                ParamPort & operator = (const ParamPort &) = delete;
+                ParamPort & operator = (ParamPort &&) = delete;
+
+            public:
+                virtual float           value() override;
+                virtual void            set_value(float value) override;
+                virtual void           *buffer() override;
+
+            public:
+                /**
+                 * Get the port of the host
+                 * @return port of the host
+                 */
+                inline plug::IPort     *port()          { return pPort;         }
+
+                /**
+                 * Drop the override if the host has changed the value of its port,
+                 * should be called by the DSP thread when settings are updated
+                 */
+                void                    sync();
+        };
+
+        /**
+         * Timestamped change of the parameter
+         */
+        typedef struct param_event_t
+        {
+            uint64_t                nFrame;         // Position in the stream the change takes effect at
+            ParamPort              *pPort;          // Shadow of the control port of the parameter
+            float                   fValue;         // New value of the parameter
+        } param_event_t;
+
+        /**
+         * Fixed-size lock-free multiple-producer single-consumer queue of parameter changes.
+         * Any thread may post events with post() which never blocks nor allocates. The DSP
+         * thread takes events in the order they have been posted with front() and pop().
+         */
+        class ParamQueue
+        {
+            protected:
+                typedef struct cell_t
+                {
+                    uatomic_t               nSeq;           // Sequence number of the cell
+                    param_event_t           sEvent;         // Event stored in the cell
+                } cell_t;
+
+            protected:
+                cell_t                 *vCells;         // Ring buffer
+                uint32_t                nCapacity;      // Capacity of the ring, power of 2
+                uatomic_t               nHead;          // Read position (consumer)
+                uatomic_t               nTail;          // Write position (producers)
+                uatomic_t               nDropped;       // Number of dropped events
+
+            public:
+                ParamQueue();
+                ParamQueue(const ParamQueue &) = delete;
+                ParamQueue(ParamQueue &&) = delete;
+                ~ParamQueue();
+
+                ParamQueue & operator = (const ParamQueue &) = delete;
+                ParamQueue & operator = (ParamQueue &&) = delete;
+
+                /**
+                 * Allocate the queue
+                 * @param capacity minimum number of events, rounded up to the power of 2
+                 * @return status of operation
+                 */
+                status_t        init(size_t capacity);
+
+                /**
+                 * Free the queue
+                 */
+                void            destroy();
+
+            public:
+                /**
+                 * Post the event, real-time safe, can be called from any thread
+                 * @param port shadow of the control port of the parameter
+                 * @param value new value of the parameter
+                 * @param frame position in the stream the change takes effect at
+                 * @return true if the event has been posted, false if the queue was full
+                 */
+                bool            post(ParamPort *port, float value, uint64_t frame);
+
+                /**
+                 * Get the oldest event without removing it, consumer side
+                 * @return pointer to the event or NULL if the queue is empty
+                 */
+                const param_event_t    *front();
+
+                /**
+                 * Remove the event returned by front(), consumer side
+                 */
+                void            pop();
+
+                /**
+                 * Get number of dropped events
+                 * @return number of dropped events
+                 */
+                size_t          dropped();
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_UTIL_PARAMQUEUE_H_ */
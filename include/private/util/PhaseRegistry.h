@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_UTIL_PHASEREGISTRY_H_
+#define PRIVATE_UTIL_PHASEREGISTRY_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Process-wide registry of FFT frame phases. Each plugin instance that performs
+         * FFT processing acquires the slot and shifts its FFT frames by the phase of the
+         * slot, so frames of different instances are processed at different host blocks.
+         * Phases of the slots follow the van der Corput sequence, so any number of the
+         * first slots covers the period uniformly. All methods are lock-free and can be
+         * called from any thread.
+         */
+        class PhaseRegistry
+        {
+            public:
+                static constexpr size_t     SLOTS_MAX       = 256;
+
+            public:
+                /**
+                 * Acquire the free slot
+                 * @return slot index or negative value if all slots are busy
+                 */
+                static ssize_t          acquire();
+
+                /**
+                 * Release the slot
+                 * @param slot slot index returned by acquire(), negative values are ignored
+                 */
+                static void             release(ssize_t slot);
+
+                /**
+                 * Get phase of the slot
+                 * @param slot slot index, negative values are allowed
+                 * @return phase of the slot in range [0, 1), 0 for negative slot index
+                 */
+                static float            phase(ssize_t slot);
+
+                /**
+                 * Get number of acquired slots
+                 * @return number of acquired slots
+                 */
+                static size_t           acquired();
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_UTIL_PHASEREGISTRY_H_ */
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_UTIL_SEMAPHORE_H_
+#define PRIVATE_UTIL_SEMAPHORE_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/types.h>
+
+#if defined(PLATFORM_WINDOWS)
+    #include <windows.h>
+#elif !defined(PLATFORM_LINUX)
+    #include <pthread.h>
+#endif /* PLATFORM_WINDOWS */
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Counting semaphore for the hand-off between the DSP thread and its helper threads.
+         * On Linux it is built on the futex: post() and try_wait() are plain atomic operations
+         * and the system is called only to wake up or put to sleep the waiting thread.
+         */
+        class Semaphore
+        {
+            protected:
+            #if defined(PLATFORM_WINDOWS)
+                HANDLE                  hSem;           // Semaphore object
+            #elif defined(PLATFORM_LINUX)
+                uatomic_t               nCount;         // Number of available tokens, futex word
+                atomic_t                nWaiters;       // Number of threads sleeping on the futex
+            #else
+                pthread_mutex_t         sMutex;         // Mutex that protects the counter
+                pthread_cond_t          sCond;          // Condition variable to wait for tokens
+                size_t                  nCount;         // Number of available tokens
+            #endif /* PLATFORM_WINDOWS */
+
+            public:
+                Semaphore();
+                Semaphore(const Semaphore &) = delete;
+                Semaphore(Semaphore &&) = delete;
+                ~Semaphore();
+
+                Semaphore & operator = (const Semaphore &) = delete;
+                Semaphore & operator = (Semaphore &&) = delete;
+
+            public:
+                /**
+                 * Add the token and wake up one waiting thread, never blocks
+                 */
+                void                    post();
+
+                /**
+                 * Take the token, wait until it is available
+                 */
+                void                    wait();
+
+                /**
+                 * Take the token if it is available, never blocks
+                 * @return true if the token has been taken
+                 */
+                bool                    try_wait();
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_UTIL_SEMAPHORE_H_ */
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_UTIL_TASKPOOL_H_
+#define PRIVATE_UTIL_TASKPOOL_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Client of the process-wide pool of threads that executes batches of independent
+         * indexed tasks submitted by DSP threads. All plugin instances share the same threads,
+         * each instance acquires its own slot in the pool. The submitter and the pool threads
+         * take tasks from the cursor of the slot until the batch is exhausted, so the load is
+         * balanced dynamically and the submitter executes tasks that pool threads did not take
+         * by itself. Pool threads sleep until a batch is submitted and run with the scheduling
+         * priority of the submitter. Neither locks nor memory allocations are performed on the
+         * DSP side.
+         */
+        class TaskPool
+        {
+            public:
+                static constexpr size_t     THREADS_MAX     = 7;
+                static constexpr size_t     TASKS_MAX       = 0xff;
+                static constexpr size_t     SLOTS_MAX       = 64;
+
+                /**
+                 * Task function
+                 * @param object object passed to start()
+                 * @param index index of the task in the batch
+                 */
+                typedef void (*task_t)(void *object, size_t index);
+
+            protected:
+                task_t                  pTask;          // Task function
+                void                   *pObject;        // Object passed to the task
+                ssize_t                 nSlot;          // Slot in the shared pool, negative if not connected
+
+            public:
+                TaskPool();
+                TaskPool(const TaskPool &) = delete;
+                TaskPool(TaskPool &&) = delete;
+                ~TaskPool();
+
+                TaskPool & operator = (const TaskPool &) = delete;
+                TaskPool & operator = (TaskPool &&) = delete;
+
+                /**
+                 * Connect to the shared pool, start shared threads if they are not running.
+                 * Should not be called from the DSP thread.
+                 * @param threads number of shared threads required by the client, limited by THREADS_MAX
+                 * @param task task function
+                 * @param object object passed to the task function
+                 * @return status of operation
+                 */
+                status_t                start(size_t threads, task_t task, void *object);
+
+                /**
+                 * Disconnect from the shared pool, stop shared threads and wait for their
+                 * termination if there are no more clients. Should not be called from the
+                 * DSP thread.
+                 */
+                void                    stop();
+
+            public:
+                /**
+                 * Check that the client is connected to the shared pool
+                 * @return true if the client is connected to the shared pool
+                 */
+                inline bool             running() const     { return nSlot >= 0;        }
+
+                /**
+                 * Get number of shared threads
+                 * @return number of shared threads
+                 */
+                static size_t           threads();
+
+                /**
+                 * Execute the batch of tasks with indices from 0 to count-1 and wait for
+                 * its completion. The caller participates in execution. Only one thread
+                 * may submit batches at a time.
+                 * @param count number of tasks, limited by TASKS_MAX
+                 */
+                void                    execute(size_t count);
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_UTIL_TASKPOOL_H_ */
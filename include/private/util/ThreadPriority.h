@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_UTIL_THREADPRIORITY_H_
+#define PRIVATE_UTIL_THREADPRIORITY_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/types.h>
+
+#ifdef PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif /* PLATFORM_WINDOWS */
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Passes the scheduling policy and priority of the DSP thread to its helper threads.
+         * The host usually runs the DSP thread with real-time priority, helper threads
+         * created by the plugin have the normal one and would be preempted by any other
+         * activity while the DSP thread waits for them. The DSP thread captures its
+         * parameters with capture() which calls the system only when the thread that
+         * processes the plugin changes, each helper thread adopts them with apply().
+         */
+        class ThreadPriority
+        {
+            public:
+                /* Value of the parameters that have not been captured yet */
+                static constexpr uatomic_t      NONE        = uatomic_t(-1);
+
+            protected:
+            #ifdef PLATFORM_WINDOWS
+                DWORD                   nOwner;         // Identifier of the captured thread
+            #else
+                pthread_t               hOwner;         // Captured thread
+            #endif /* PLATFORM_WINDOWS */
+                bool                    bOwner;         // The thread has been captured
+                uatomic_t               nParams;        // Packed policy and priority of the captured thread
+
+            public:
+                ThreadPriority();
+                ThreadPriority(const ThreadPriority &) = delete;
+                ThreadPriority(ThreadPriority &&) = delete;
+
+                ThreadPriority & operator = (const ThreadPriority &) = delete;
+                ThreadPriority & operator = (ThreadPriority &&) = delete;
+
+            public:
+                /**
+                 * Capture parameters of the calling thread, should be called by the thread
+                 * that submits jobs. Does not call the system if the thread did not change.
+                 */
+                void                    capture();
+
+                /**
+                 * Apply captured parameters to the calling helper thread if they differ
+                 * from the ones applied before
+                 * @param applied parameters applied to the calling thread before, should be
+                 *   initialized with NONE, is updated by the call
+                 */
+                void                    apply(uatomic_t *applied);
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_UTIL_THREADPRIORITY_H_ */
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_UTIL_WORKER_H_
+#define PRIVATE_UTIL_WORKER_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+#include <private/util/Semaphore.h>
+#include <private/util/ThreadPriority.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Dedicated thread that executes jobs submitted by the DSP thread. The worker sleeps
+         * on the semaphore until the job is submitted and runs with the scheduling priority
+         * of the submitter. If the worker did not pick up the job by the time join() is
+         * called, the job is taken back and executed by the joining thread. Otherwise the
+         * joining thread spins for a short time and then sleeps until the job is completed.
+         */
+        class Worker
+        {
+            public:
+                /**
+                 * Job function
+                 * @param object object passed to start()
+                 * @param arg argument passed to submit()
+                 */
+                typedef void (*job_t)(void *object, size_t arg);
+
+            protected:
+                enum state_t
+                {
+                    WS_IDLE,                            // No job is pending
+                    WS_PENDING,                         // Job has been submitted
+                    WS_RUNNING,                         // Job is executed by the worker
+                    WS_DONE                             // Job has been completed by the worker
+                };
+
+            protected:
+                ipc::Thread            *pThread;        // Worker thread
+                job_t                   pJob;           // Job function
+                void                   *pObject;        // Object passed to the job
+                size_t                  nArg;           // Argument of the pending job
+                uatomic_t               nState;         // State of the job
+                uatomic_t               nShutdown;      // Shutdown request
+                Semaphore               sJob;           // Wakes up the worker
+                Semaphore               sDone;          // Wakes up the joining thread
+                ThreadPriority          sPriority;      // Priority of the submitter
+
+            protected:
+                static status_t         thread_proc(void *arg);
+                status_t                run();
+
+            public:
+                Worker();
+                Worker(const Worker &) = delete;
+                Worker(Worker &&) = delete;
+                ~Worker();
+
+                Worker & operator = (const Worker &) = delete;
+                Worker & operator = (Worker &&) = delete;
+
+                /**
+                 * Create the worker thread
+                 * @param job job function
+                 * @param object object passed to the job function
+                 * @return status of operation
+                 */
+                status_t                start(job_t job, void *object);
+
+                /**
+                 * Stop the worker thread and wait for its termination
+                 */
+                void                    stop();
+
+            public:
+                /**
+                 * Check that the worker thread is running
+                 * @return true if the worker thread is running
+                 */
+                inline bool             running() const     { return pThread != NULL;   }
+
+                /**
+                 * Submit the job and wake up the worker, should be followed by join().
+                 * Does not block.
+                 * @param arg argument of the job
+                 */
+                void                    submit(size_t arg);
+
+                /**
+                 * Wait for completion of the submitted job or execute it in the caller's thread
+                 * if the worker has not started it yet.
+                 */
+                void                    join();
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_UTIL_WORKER_H_ */
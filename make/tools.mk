@@ -138,6 +138,11 @@ ifeq ($(PROFILE),1)
   NOARCH_CXXFLAGS    += -pg -DLSP_PROFILE
 endif
 
+ifeq ($(INSTRUMENT),1)
+  NOARCH_CFLAGS      += -DLSP_INSTRUMENT
+  NOARCH_CXXFLAGS    += -DLSP_INSTRUMENT
+endif
+
 ifeq ($(TRACE),1)
   NOARCH_CFLAGS      += -DLSP_TRACE
   NOARCH_CXXFLAGS    += -DLSP_TRACE
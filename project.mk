@@ -25,7 +25,7 @@ ARTIFACT_TYPE               = plug
 ARTIFACT_DESC               = LSP Multiband Limiter Plugin Series
 ARTIFACT_HEADERS            = lsp-plug.in
 ARTIFACT_EXPORT_HEADERS     = 0
-ARTIFACT_VERSION            = 1.0.20
+ARTIFACT_VERSION            = 1.0.21
 
 
 
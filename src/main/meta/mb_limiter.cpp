@@ -26,7 +26,7 @@
 
 #define LSP_PLUGINS_MB_LIMITER_VERSION_MAJOR       1
 #define LSP_PLUGINS_MB_LIMITER_VERSION_MINOR       0
-#define LSP_PLUGINS_MB_LIMITER_VERSION_MICRO       20
+#define LSP_PLUGINS_MB_LIMITER_VERSION_MICRO       21
 
 #define LSP_PLUGINS_MB_LIMITER_VERSION  \
     LSP_MODULE_VERSION( \
@@ -249,6 +249,25 @@ namespace lsp
             MBL_METERS("_l", " Left", " L"), \
             MBL_METERS("_r", " Right", " R")
 
+        #define MBL_PARALLEL \
+            SWITCH("mt", "Parallel processing of channels", "Parallel", 0.0f)
+
+        #define MBL_BAND_PARALLEL \
+            SWITCH("bmt", "Parallel processing of bands", "Parallel bands", 0.0f)
+
+        #define MBL_PIPELINE \
+            SWITCH("pipe", "Pipelined processing", "Pipelined", 0.0f)
+
+        #define MBL_TILED \
+            SWITCH("tile", "Cache-blocked processing of bands", "Tiled", 0.0f)
+
+    #ifdef LSP_INSTRUMENT
+        #define MBL_PROFILING \
+            METER("prof", "DSP cycles per sample", U_NONE, mb_limiter::PROFILE),
+    #else
+        #define MBL_PROFILING
+    #endif /* LSP_INSTRUMENT */
+
         static const port_t mb_limiter_mono_ports[] =
         {
             // Input and output audio ports
@@ -276,6 +295,10 @@ namespace lsp
             MBL_BAND_MONO("_7", " 7", " 7"),
             MBL_BAND_MONO("_8", " 8", " 8"),
 
+            MBL_BAND_PARALLEL,
+            MBL_PIPELINE,
+            MBL_TILED,
+            MBL_PROFILING
             PORTS_END
         };
 
@@ -306,6 +329,11 @@ namespace lsp
             MBL_BAND_STEREO("_7", " 7", " 7"),
             MBL_BAND_STEREO("_8", " 8", " 8"),
 
+            MBL_PARALLEL,
+            MBL_BAND_PARALLEL,
+            MBL_PIPELINE,
+            MBL_TILED,
+            MBL_PROFILING
             PORTS_END
         };
 
@@ -337,6 +365,10 @@ namespace lsp
             MBL_BAND_MONO("_7", " 7", " 7"),
             MBL_BAND_MONO("_8", " 8", " 8"),
 
+            MBL_BAND_PARALLEL,
+            MBL_PIPELINE,
+            MBL_TILED,
+            MBL_PROFILING
             PORTS_END
         };
 
@@ -368,6 +400,11 @@ namespace lsp
             MBL_BAND_STEREO("_7", " 7", " 7"),
             MBL_BAND_STEREO("_8", " 8", " 8"),
 
+            MBL_PARALLEL,
+            MBL_BAND_PARALLEL,
+            MBL_PIPELINE,
+            MBL_TILED,
+            MBL_PROFILING
             PORTS_END
         };
 
@@ -28,10 +28,19 @@
 #include <lsp-plug.in/dsp-units/units.h>
 #include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
 #include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/ipc/IExecutor.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/runtime/LSPString.h>
+#include <lsp-plug.in/runtime/system.h>
 #include <lsp-plug.in/shared/debug.h>
 #include <lsp-plug.in/shared/id_colors.h>
 
 #include <private/plugins/mb_limiter.h>
+#include <private/util/PhaseRegistry.h>
+
+#ifdef PLATFORM_LINUX
+    #include <unistd.h>
+#endif /* PLATFORM_LINUX */
 
 namespace lsp
 {
@@ -39,6 +48,94 @@ namespace lsp
     {
         /* The size of temporary buffer for audio processing */
         static constexpr size_t BUFFER_SIZE     = 0x200;
+        /* Maximum number of shared threads for parallel processing of bands besides DSP threads */
+        static constexpr size_t BAND_THREADS    = 3;
+        /* Minimum number of samples per channel buffered for the analysis thread */
+        static constexpr size_t ANALYSIS_RING_SIZE  = 0x4000;
+        /* Minimum period of waking up the analysis thread, milliseconds */
+        static constexpr size_t ANALYSIS_PERIOD = 5;
+        /* Minimum number of pending parameter changes */
+        static constexpr size_t PARAM_QUEUE_SIZE    = 0x400;
+        /* Size of the L1 data cache if it can not be obtained from the system */
+        static constexpr size_t L1_CACHE_SIZE   = 0x8000;
+        /* Minimum number of oversampled samples in the tile of cache-blocked processing */
+        static constexpr size_t TILE_SIZE_MIN   = 0x40;
+        /* Granularity of the tile size, keeps tiles aligned for vectorized processing */
+        static constexpr size_t TILE_SIZE_STEP  = 0x10;
+
+        static size_t l1_cache_size()
+        {
+        #if defined(PLATFORM_LINUX) && defined(_SC_LEVEL1_DCACHE_SIZE)
+            const long size = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+            if (size > 0)
+                return size;
+        #endif /* PLATFORM_LINUX */
+            return L1_CACHE_SIZE;
+        }
+
+#ifdef LSP_INSTRUMENT
+        static const char *profile_stage_names[] =
+        {
+            "premix",
+            "oversample",
+            "vca_gain",
+            "stereo_link",
+            "apply_vca",
+            "single_band",
+            "downsample",
+            "output",
+            "analysis"
+        };
+
+        static inline uint64_t read_cycles()
+        {
+        #if defined(ARCH_X86)
+            return __builtin_ia32_rdtsc();
+        #elif defined(ARCH_AARCH64)
+            uint64_t value;
+            __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (value));
+            return value;
+        #else
+            system::time_t ts;
+            system::get_time(&ts);
+            return uint64_t(ts.seconds) * 1000000000u + ts.nanos;
+        #endif
+        }
+
+        #define PROFILE_BEGIN(ts) \
+            uint64_t ts = read_cycles();
+        /* Counters are updated by the DSP thread and the worker concurrently */
+        static inline void profile_add(uint64_t *counter, uint64_t value)
+        {
+            __atomic_fetch_add(counter, value, __ATOMIC_RELAXED);
+        }
+
+        #define PROFILE_STAGE(ts, stage) \
+            { \
+                const uint64_t now__ = read_cycles(); \
+                profile_add(&sProfile.vStages[stage], now__ - ts); \
+                ts = now__; \
+            }
+        #define PROFILE_BAND(ts, band) \
+            { \
+                const uint64_t now__ = read_cycles(); \
+                profile_add(&sProfile.vBands[band], now__ - ts); \
+                ts = now__; \
+            }
+        #define PROFILE_SKIP(ts) \
+            ts = read_cycles();
+        #define TRACE_EVENT(type, arg) \
+            sTrace.record(type, arg);
+
+        /* The capacity of the event trace ring */
+        static constexpr size_t TRACE_CAPACITY  = 0x1000;
+#else
+        #define PROFILE_BEGIN(ts)
+        #define PROFILE_STAGE(ts, stage)
+        #define PROFILE_BAND(ts, band)
+        #define PROFILE_SKIP(ts)
+        #define TRACE_EVENT(type, arg)
+#endif /* LSP_INSTRUMENT */
 
         //---------------------------------------------------------------------
         // Plugin factory
@@ -77,7 +174,36 @@ namespace lsp
 
         //---------------------------------------------------------------------
         // Implementation
-        mb_limiter::mb_limiter(const meta::plugin_t *meta):
+        mb_limiter::ResourceTask::ResourceTask(mb_limiter *plugin)
+        {
+            pPlugin             = plugin;
+            atomic_store(&nState, RT_ATTACHED);
+        }
+
+        mb_limiter::ResourceTask::~ResourceTask()
+        {
+            pPlugin             = NULL;
+        }
+
+        status_t mb_limiter::ResourceTask::run()
+        {
+            // The plugin does not exist anymore if the task has been detached
+            if (!atomic_cas(&nState, RT_ATTACHED, RT_RUNNING))
+                return STATUS_OK;
+
+            pPlugin->update_resources();
+            atomic_store(&nState, RT_ATTACHED);
+
+            return STATUS_OK;
+        }
+
+        bool mb_limiter::ResourceTask::detach()
+        {
+            return atomic_cas(&nState, RT_ATTACHED, RT_DETACHED);
+        }
+
+        //---------------------------------------------------------------------
+        mb_limiter::mb_limiter(const meta::plugin_t *meta, size_t streams):
             Module(meta)
         {
             sPremix.fInToSc     = GAIN_AMP_M_INF_DB;
@@ -108,6 +234,19 @@ namespace lsp
             nChannels           = 1;
             nMode               = XOVER_CLASSIC;
             bSidechain          = false;
+            bParallel           = false;
+            bBandParallel       = false;
+            bPipeline           = false;
+            bTiled              = false;
+            bParallelReq        = false;
+            bBandParallelReq    = false;
+            bPipelineReq        = false;
+            bTiledReq           = false;
+            atomic_store(&nResRequest, 0);
+            atomic_store(&nResTried, 0);
+            atomic_store(&nResources, 0);
+            nResApplied         = 0;
+            pResTask            = NULL;
 
             if ((!strcmp(meta->uid, meta::mb_limiter_stereo.uid)) ||
                 (!strcmp(meta->uid, meta::sc_mb_limiter_stereo.uid)))
@@ -117,7 +256,18 @@ namespace lsp
                 (!strcmp(meta->uid, meta::sc_mb_limiter_stereo.uid)))
                 bSidechain      = true;
 
+            // Each stream of the bank is processed as the separate mono channel
+            nStreams            = ((nChannels == 1) && (!bSidechain)) ? lsp_max(streams, size_t(1)) : 0;
+            nStates             = lsp_max(nChannels, nStreams);
+
             bEnvUpdate          = true;
+            bAnUpdate           = true;
+            bAnActive           = false;
+            pAnThread           = NULL;
+            atomic_store(&nAnLock, 0);
+            atomic_store(&nAnShutdown, 0);
+            nAnSamples          = 0;
+            nAnPeriod           = 0;
             nScMode             = SCM_INTERNAL;
             fInGain             = GAIN_AMP_0_DB;
             fOutGain            = GAIN_AMP_0_DB;
@@ -125,15 +275,28 @@ namespace lsp
             nEnvBoost           = -1;
             nRealSampleRate     = 0;
             nLookahead          = 0;
+            nStageSamples       = 0;
+            nStageOvsSamples    = 0;
+            nPhaseSlot          = -1;
+            pBandChannel        = NULL;
+            nBandSamples        = 0;
+            nPipeSamples        = 0;
+            nPipeOvsSamples     = 0;
+            nPipeFill           = 0;
+            nTileSize           = 0;
+            nTileRequest        = 0;
+            nCacheSize          = L1_CACHE_SIZE;
+            nFrame              = 0;
 
             vChannels           = NULL;
-            vTmpBuf             = NULL;
-            vEnvBuf             = NULL;
             vFreqs              = NULL;
             vIndexes            = NULL;
             vTr                 = NULL;
             vTrTmp              = NULL;
             vFc                 = NULL;
+            vAnBuf              = NULL;
+            vMbLinkBuf          = NULL;
+            vSbLinkBuf          = NULL;
             pIDisplay           = NULL;
 
             for (size_t i=0; i<(meta::mb_limiter::BANDS_MAX-1); ++i)
@@ -147,9 +310,24 @@ namespace lsp
                 s->pFreq            = NULL;
             }
 
+            init_limiter_ports(&sLimiterPorts);
+            for (size_t i=0; i<meta::mb_limiter::BANDS_MAX; ++i)
+            {
+                band_ports_t *b     = &vBandPorts[i];
+
+                init_limiter_ports(&b->sLimiter);
+                b->pFreqEnd         = NULL;
+                b->pSolo            = NULL;
+                b->pMute            = NULL;
+                b->pPreamp          = NULL;
+                b->pMakeup          = NULL;
+                b->pBandGraph       = NULL;
+            }
+
             nPlanSize           = 0;
             for (size_t i=0; i<meta::mb_limiter::BANDS_MAX; ++i)
                 vPlan[i]            = 0;
+            pProcess            = select_process();
 
             pBypass             = NULL;
             pInGain             = NULL;
@@ -161,10 +339,29 @@ namespace lsp
             pEnvBoost           = NULL;
             pZoom               = NULL;
             pScMode             = NULL;
+            pParallel           = NULL;
+            pBandParallel       = NULL;
+            pPipeline           = NULL;
+            pTiled              = NULL;
             pReactivity         = NULL;
             pShift              = NULL;
 
             pData               = NULL;
+            pPipeData           = NULL;
+
+        #ifdef LSP_INSTRUMENT
+            for (size_t i=0; i<ST_TOTAL; ++i)
+                sProfile.vStages[i] = 0;
+            for (size_t i=0; i<meta::mb_limiter::BANDS_MAX; ++i)
+                sProfile.vBands[i]  = 0;
+            sProfile.nCycles    = 0;
+            sProfile.nSamples   = 0;
+            sProfile.nCalls     = 0;
+            sProfile.fLoad      = 0.0f;
+            pProfile            = NULL;
+            pTraceWriter        = NULL;
+            nTraceLatency       = -1;
+        #endif /* LSP_INSTRUMENT */
         }
 
         mb_limiter::~mb_limiter()
@@ -184,21 +381,27 @@ namespace lsp
             size_t szof_buf         = BUFFER_SIZE * sizeof(float);
             size_t szof_ovs_buf     = szof_buf * meta::mb_limiter::OVERSAMPLING_MAX;
             size_t to_alloc         =
-                szof_channel * nChannels +      // vChannels
+                szof_channel * nStates +        // vChannels
                 szof_buf +                      // vEmptyBuf
-                szof_ovs_buf +                  // vTmpBuf
-                szof_ovs_buf +                  // vEnvBuf
                 szof_fft_graph +                // vFreqs
                 szof_indexes +                  // vIndexes
                 szof_fft_graph * 2 +            // vTr
                 szof_fft_graph * 2 +            // vTrTmp
                 szof_fft_graph * 2 +            // vFc
+                szof_ovs_buf * 2 +              // vMbLinkBuf
+                szof_ovs_buf * 2 +              // vSbLinkBuf
                 nChannels * (
                     szof_buf*3 +                // sPremix
+                    szof_buf * 2                // vAnBuf
+                ) +
+                nStates * (
                     szof_buf +                  // vData
                     szof_ovs_buf +              // vInBuf
+                    szof_buf +                  // vPipeOut
                     szof_ovs_buf +              // vScBuf
                     szof_ovs_buf +              // vDataBuf
+                    szof_ovs_buf +              // vTmpBuf
+                    szof_ovs_buf +              // vEnvBuf
                     szof_fft_graph +            // vTrOut
                     szof_ovs_buf +              // vVcaBuf
                     meta::mb_limiter::BANDS_MAX * (
@@ -218,23 +421,34 @@ namespace lsp
             sAnalyzer.set_window(meta::mb_limiter::FFT_WINDOW);
             sAnalyzer.set_rate(meta::mb_limiter::REFRESH_RATE);
 
+            // Initialize data exchange with the analysis thread
+            if (sAnRing.init(nChannels * 2, ANALYSIS_RING_SIZE) != STATUS_OK)
+                return;
+            if (sAnSpectrum.init(nChannels * 2 * meta::mb_limiter::FFT_MESH_POINTS) != STATUS_OK)
+                return;
+
             sCounter.set_frequency(meta::mb_limiter::REFRESH_RATE, true);
 
+            // Initialize queue of parameter changes
+            if (sEvents.init(PARAM_QUEUE_SIZE) != STATUS_OK)
+                return;
+
             // Allocate data
-            uint8_t *ptr            = alloc_aligned<uint8_t>(pData, to_alloc);
+            uint8_t *ptr            = alloc_aligned<uint8_t>(pData, to_alloc, OPTIMAL_ALIGN);
             if (ptr == NULL)
                 return;
             lsp_guard_assert( const uint8_t *tail = &ptr[to_alloc]; );
 
             // Allocate objects
-            vChannels               = advance_ptr_bytes<channel_t>(ptr, szof_channel * nChannels);
-            vTmpBuf                 = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
-            vEnvBuf                 = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
+            vChannels               = advance_ptr_bytes<channel_t>(ptr, szof_channel * nStates);
             vFreqs                  = advance_ptr_bytes<float>(ptr, szof_fft_graph);
             vIndexes                = advance_ptr_bytes<uint32_t>(ptr, szof_indexes);
             vTr                     = advance_ptr_bytes<float>(ptr, szof_fft_graph * 2);
             vTrTmp                  = advance_ptr_bytes<float>(ptr, szof_fft_graph * 2);
             vFc                     = advance_ptr_bytes<float>(ptr, szof_fft_graph * 2);
+            vAnBuf                  = advance_ptr_bytes<float>(ptr, szof_buf * 2 * nChannels);
+            vMbLinkBuf              = advance_ptr_bytes<float>(ptr, szof_ovs_buf * 2);
+            vSbLinkBuf              = advance_ptr_bytes<float>(ptr, szof_ovs_buf * 2);
 
             // Initialize pre-mix
             for (size_t i=0; i<nChannels; ++i)
@@ -249,7 +463,7 @@ namespace lsp
                 floorf(dspu::samples_to_millis(MAX_SAMPLE_RATE, meta::mb_limiter::OVERSAMPLING_MAX)) +
                 meta::mb_limiter::LOOKAHEAD_MAX + 1.0f;
 
-            for (size_t i=0; i<nChannels; ++i)
+            for (size_t i=0; i<nStates; ++i)
             {
                 channel_t *c    = &vChannels[i];
 
@@ -295,21 +509,6 @@ namespace lsp
                 l->fInLevel         = GAIN_AMP_M_INF_DB;
                 l->fReductionLevel  = GAIN_AMP_0_DB;
                 l->vVcaBuf          = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
-
-                l->pEnable          = NULL;
-                l->pAlrOn           = NULL;
-                l->pAlrAttack       = NULL;
-                l->pAlrRelease      = NULL;
-                l->pAlrKneeLevel    = NULL;
-                l->pAlrKneeSmooth   = NULL;
-
-                l->pMode            = NULL;
-                l->pThresh          = NULL;
-                l->pBoost           = NULL;
-                l->pAttack          = NULL;
-                l->pRelease         = NULL;
-                l->pInMeter         = NULL;
-                l->pStereoLink      = NULL;
                 l->pReductionMeter  = NULL;
 
                 // Initialize fields
@@ -319,8 +518,13 @@ namespace lsp
                 c->vOut             = NULL;
                 c->vData            = advance_ptr_bytes<float>(ptr, szof_buf);
                 c->vInBuf           = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
+                c->vApplyBuf        = c->vInBuf;
+                c->vPipeInBuf       = NULL;
+                c->vPipeOut         = advance_ptr_bytes<float>(ptr, szof_buf);
                 c->vScBuf           = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
                 c->vDataBuf         = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
+                c->vTmpBuf          = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
+                c->vEnvBuf          = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
                 c->vTrOut           = advance_ptr_bytes<float>(ptr, szof_fft_graph);
                 c->nAnInChannel     = an_id++;
                 c->nAnOutChannel    = an_id++;
@@ -369,17 +573,13 @@ namespace lsp
                     b->fFreqStart       = 0.0f;
                     b->fFreqEnd         = 0.0f;
                     b->fMakeup          = GAIN_AMP_0_DB;
+                    b->fXoverStart      = 0.0f;
+                    b->fXoverEnd        = 0.0f;
+                    b->nXoverFlags      = 0;
 
                     b->vDataBuf         = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
                     b->vTrOut           = advance_ptr_bytes<float>(ptr, szof_fft_graph);
 
-                    b->pFreqEnd         = NULL;
-                    b->pSolo            = NULL;
-                    b->pMute            = NULL;
-                    b->pPreamp          = NULL;
-                    b->pMakeup          = NULL;
-                    b->pBandGraph       = NULL;
-
                     // limiter_t
                     l                   = &b->sLimiter;
                     l->sLimit.construct();
@@ -393,21 +593,8 @@ namespace lsp
                     l->fInLevel         = GAIN_AMP_M_INF_DB;
                     l->fReductionLevel  = GAIN_AMP_0_DB;
                     l->vVcaBuf          = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
-
-                    l->pEnable          = NULL;
-                    l->pAlrOn           = NULL;
-                    l->pAlrAttack       = NULL;
-                    l->pAlrRelease      = NULL;
-                    l->pAlrKneeLevel    = NULL;
-                    l->pAlrKneeSmooth   = NULL;
-
-                    l->pMode            = NULL;
-                    l->pThresh          = NULL;
-                    l->pBoost           = NULL;
-                    l->pAttack          = NULL;
-                    l->pRelease         = NULL;
-                    l->pInMeter         = NULL;
-                    l->pStereoLink      = NULL;
+                    b->vVcaGain         = l->vVcaBuf;
+                    b->vPipeVcaBuf      = NULL;
                     l->pReductionMeter  = NULL;
                 }
             }
@@ -479,52 +666,27 @@ namespace lsp
 
             // Bind main limiter ports
             lsp_trace("Binding main limiter ports");
-            for (size_t i=0; i<nChannels; ++i)
             {
-                channel_t *c        = &vChannels[i];
-                limiter_t *l        = &c->sLimiter;
-
-                if (i > 0)
-                {
-                    channel_t *sc       = &vChannels[0];
-                    limiter_t *sl       = &sc->sLimiter;
-
-                    l->pEnable          = sl->pEnable;
-                    l->pAlrOn           = sl->pAlrOn;
-                    l->pAlrAttack       = sl->pAlrAttack;
-                    l->pAlrRelease      = sl->pAlrRelease;
-                    l->pAlrKneeLevel    = sl->pAlrKneeLevel;
-                    l->pAlrKneeSmooth   = sl->pAlrKneeSmooth;
-
-                    l->pMode            = sl->pMode;
-                    l->pThresh          = sl->pThresh;
-                    l->pBoost           = sl->pBoost;
-                    l->pAttack          = sl->pAttack;
-                    l->pRelease         = sl->pRelease;
-                    l->pInMeter         = NULL;
-                    l->pStereoLink      = NULL;
-                }
-                else
-                {
-                    BIND_PORT(l->pEnable);
-                    BIND_PORT(l->pAlrOn);
-                    BIND_PORT(l->pAlrAttack);
-                    BIND_PORT(l->pAlrRelease);
-                    BIND_PORT(l->pAlrKneeLevel);
-                    BIND_PORT(l->pAlrKneeSmooth);
-
-                    BIND_PORT(l->pMode);
-                    BIND_PORT(l->pThresh);
-                    BIND_PORT(l->pBoost);
-                    BIND_PORT(l->pAttack);
-                    BIND_PORT(l->pRelease);
-                    BIND_PORT(l->pInMeter);
-                    if (nChannels > 1)
-                        BIND_PORT(l->pStereoLink);
-                }
-
-                BIND_PORT(l->pReductionMeter);
+                limiter_ports_t *p  = &sLimiterPorts;
+
+                BIND_PORT(p->pEnable);
+                BIND_PORT(p->pAlrOn);
+                BIND_PORT(p->pAlrAttack);
+                BIND_PORT(p->pAlrRelease);
+                BIND_PORT(p->pAlrKneeLevel);
+                BIND_PORT(p->pAlrKneeSmooth);
+
+                BIND_PORT(p->pMode);
+                BIND_PORT(p->pThresh);
+                BIND_PORT(p->pBoost);
+                BIND_PORT(p->pAttack);
+                BIND_PORT(p->pRelease);
+                BIND_PORT(p->pInMeter);
+                if (nChannels > 1)
+                    BIND_PORT(p->pStereoLink);
             }
+            for (size_t i=0; i<nChannels; ++i)
+                BIND_PORT(vChannels[i].sLimiter.pReductionMeter);
 
             // Bind split ports
             lsp_trace("Binding split ports");
@@ -540,73 +702,113 @@ namespace lsp
             lsp_trace("Binding band-related ports");
             for (size_t i=0; i<meta::mb_limiter::BANDS_MAX; ++i)
             {
-                for (size_t j=0; j<nChannels; ++j)
-                {
-                    channel_t *c        = &vChannels[j];
-                    band_t *b           = &c->vBands[i];
+                band_ports_t *b     = &vBandPorts[i];
+                limiter_ports_t *p  = &b->sLimiter;
+
+                BIND_PORT(b->pFreqEnd);
+                BIND_PORT(b->pSolo);
+                BIND_PORT(b->pMute);
+                BIND_PORT(b->pPreamp);
+                BIND_PORT(b->pMakeup);
+                BIND_PORT(b->pBandGraph);
+
+                BIND_PORT(p->pEnable);
+                BIND_PORT(p->pAlrOn);
+                BIND_PORT(p->pAlrAttack);
+                BIND_PORT(p->pAlrRelease);
+                BIND_PORT(p->pAlrKneeLevel);
+                BIND_PORT(p->pAlrKneeSmooth);
+
+                BIND_PORT(p->pMode);
+                BIND_PORT(p->pThresh);
+                BIND_PORT(p->pBoost);
+                BIND_PORT(p->pAttack);
+                BIND_PORT(p->pRelease);
+                BIND_PORT(p->pInMeter);
+                if (nChannels > 1)
+                    BIND_PORT(p->pStereoLink);
 
-                    if (j > 0)
-                    {
-                        channel_t *sc       = &vChannels[0];
-                        band_t *sb          = &sc->vBands[i];
-                        limiter_t *sl       = &sb->sLimiter;
-                        limiter_t *l        = &b->sLimiter;
-
-                        b->pFreqEnd         = sb->pFreqEnd;
-                        b->pSolo            = sb->pSolo;
-                        b->pMute            = sb->pMute;
-                        b->pPreamp          = sb->pPreamp;
-                        b->pMakeup          = sb->pMakeup;
-                        b->pBandGraph       = NULL;
-
-                        l->pEnable          = sl->pEnable;
-                        l->pAlrOn           = sl->pAlrOn;
-                        l->pAlrAttack       = sl->pAlrAttack;
-                        l->pAlrRelease      = sl->pAlrRelease;
-                        l->pAlrKneeLevel    = sl->pAlrKneeLevel;
-                        l->pAlrKneeSmooth   = sl->pAlrKneeSmooth;
-
-                        l->pMode            = sl->pMode;
-                        l->pThresh          = sl->pThresh;
-                        l->pBoost           = sl->pBoost;
-                        l->pAttack          = sl->pAttack;
-                        l->pRelease         = sl->pRelease;
-                        l->pInMeter         = NULL;
-                        l->pStereoLink      = NULL;
-                    }
-                    else
-                    {
-                        limiter_t *l        = &b->sLimiter;
-
-                        BIND_PORT(b->pFreqEnd);
-                        BIND_PORT(b->pSolo);
-                        BIND_PORT(b->pMute);
-                        BIND_PORT(b->pPreamp);
-                        BIND_PORT(b->pMakeup);
-                        BIND_PORT(b->pBandGraph);
-
-                        BIND_PORT(l->pEnable);
-                        BIND_PORT(l->pAlrOn);
-                        BIND_PORT(l->pAlrAttack);
-                        BIND_PORT(l->pAlrRelease);
-                        BIND_PORT(l->pAlrKneeLevel);
-                        BIND_PORT(l->pAlrKneeSmooth);
-
-                        BIND_PORT(l->pMode);
-                        BIND_PORT(l->pThresh);
-                        BIND_PORT(l->pBoost);
-                        BIND_PORT(l->pAttack);
-                        BIND_PORT(l->pRelease);
-                        BIND_PORT(l->pInMeter);
-                        if (nChannels > 1)
-                            BIND_PORT(l->pStereoLink);
-                    }
+                // Streams of the bank have no meters
+                for (size_t j=0; j<nChannels; ++j)
+                    BIND_PORT(vChannels[j].vBands[i].sLimiter.pReductionMeter);
+            }
 
-                    BIND_PORT(b->sLimiter.pReductionMeter);
-                }
+            if (nChannels > 1)
+            {
+                lsp_trace("Binding parallel processing port");
+                BIND_PORT(pParallel);
+            }
+            BIND_PORT(pBandParallel);
+            BIND_PORT(pPipeline);
+            BIND_PORT(pTiled);
+
+        #ifdef LSP_INSTRUMENT
+            lsp_trace("Binding profiling ports");
+            BIND_PORT(pProfile);
+        #endif /* LSP_INSTRUMENT */
+
+            // Parameters that can be changed inside of the block are read through plugin-side
+            // shadows of their ports, see post_param()
+            wrap_param(&pInGain);
+            wrap_param(&pOutGain);
+            wrap_limiter_params(&sLimiterPorts);
+            for (size_t i=0; i<meta::mb_limiter::BANDS_MAX; ++i)
+            {
+                band_ports_t *p     = &vBandPorts[i];
+                wrap_limiter_params(&p->sLimiter);
+                wrap_param(&p->pPreamp);
+                wrap_param(&p->pMakeup);
             }
+
+            // Worker threads and the analysis thread are started by update_resources() when
+            // the processing mode or the analyzer that needs them is enabled for the first time.
+            // The task is allocated separately since it may outlive the plugin in the executor
+            pResTask            = new ResourceTask(this);
+
+            // The size of tiles for cache-blocked processing depends on the size of the L1 cache
+            nCacheSize          = l1_cache_size();
+
+        #ifdef LSP_INSTRUMENT
+            init_trace();
+        #endif /* LSP_INSTRUMENT */
+        }
+
+    #ifdef LSP_INSTRUMENT
+        void mb_limiter::init_trace()
+        {
+            if (sTrace.init(TRACE_CAPACITY) != STATUS_OK)
+                return;
+
+            pTraceWriter        = new EventTraceWriter(&sTrace);
+            if (pTraceWriter == NULL)
+                return;
+
+            // Each instance writes the trace into the separate file in the temporary directory
+            LSPString path;
+            if (system::get_temporary_dir(&path) != STATUS_OK)
+                return;
+            if (!path.fmt_append_ascii("/lsp-mb_limiter-trace-%p.log", this))
+                return;
+            pTraceWriter->set_path(path.get_native());
+            lsp_trace("Event trace file: %s", pTraceWriter->path());
         }
 
+        void mb_limiter::flush_trace()
+        {
+            if ((pTraceWriter == NULL) || (pTraceWriter->path() == NULL) || (sTrace.pending() <= 0))
+                return;
+
+            if (pTraceWriter->completed())
+                pTraceWriter->reset();
+            if (!pTraceWriter->idle())
+                return;
+
+            ipc::IExecutor *executor = (pWrapper != NULL) ? pWrapper->executor() : NULL;
+            if (executor != NULL)
+                executor->submit(pTraceWriter);
+        }
+    #endif /* LSP_INSTRUMENT */
+
         void mb_limiter::destroy()
         {
             plug::Module::destroy();
@@ -615,13 +817,64 @@ namespace lsp
 
         void mb_limiter::do_destroy()
         {
+            // Wait for the resource task, then stop the worker since it accesses channels
+            if (pResTask != NULL)
+            {
+                // The queued task is left to the executor since the executor may never run it.
+                // The running task completes in a bounded time, so it is safe to wait for it
+                if ((pResTask->idle()) || (pResTask->completed()) || (!pResTask->detach()))
+                {
+                    while ((!pResTask->idle()) && (!pResTask->completed()))
+                        ipc::Thread::sleep(1);
+                    delete pResTask;
+                }
+                pResTask        = NULL;
+            }
+            sWorker.stop();
+            sBandPool.stop();
+            atomic_store(&nResources, 0);
+            nResApplied     = 0;
+            bParallel       = false;
+            bBandParallel   = false;
+            bPipeline       = false;
+
+            // Stop the analysis thread since it accesses the analyzer
+            if (pAnThread != NULL)
+            {
+                atomic_store(&nAnShutdown, 1);
+                sAnWake.post();
+                pAnThread->join();
+                delete pAnThread;
+                pAnThread       = NULL;
+            }
+
+        #ifdef LSP_INSTRUMENT
+            // Destroy event trace
+            if (pTraceWriter != NULL)
+            {
+                delete pTraceWriter;
+                pTraceWriter    = NULL;
+            }
+            sTrace.destroy();
+        #endif /* LSP_INSTRUMENT */
+
+            // Release FFT frame phase
+            PhaseRegistry::release(nPhaseSlot);
+            nPhaseSlot      = -1;
+
             // Destroy processors
             sAnalyzer.destroy();
+            sAnRing.destroy();
+            sAnSpectrum.destroy();
+            sEvents.destroy();
+            for (size_t i=0, n=vParamPorts.size(); i<n; ++i)
+                delete vParamPorts.uget(i);
+            vParamPorts.flush();
 
             // Destroy channels
             if (vChannels != NULL)
             {
-                for (size_t i=0; i<nChannels; ++i)
+                for (size_t i=0; i<nStates; ++i)
                 {
                     channel_t *c    = &vChannels[i];
 
@@ -666,6 +919,11 @@ namespace lsp
                 free_aligned(pData);
                 pData           = NULL;
             }
+            if (pPipeData != NULL)
+            {
+                free_aligned(pPipeData);
+                pPipeData       = NULL;
+            }
         }
 
         size_t mb_limiter::select_fft_rank(size_t sample_rate)
@@ -677,22 +935,29 @@ namespace lsp
 
         void mb_limiter::update_sample_rate(long sr)
         {
+            flush_pipeline();
+
             size_t fft_rank     = select_fft_rank(sr * meta::mb_limiter::OVERSAMPLING_MAX);
             size_t bins         = 1 << fft_rank;
             float lk_latency        =
                 floorf(dspu::samples_to_millis(MAX_SAMPLE_RATE, meta::mb_limiter::OVERSAMPLING_MAX)) +
                 meta::mb_limiter::LOOKAHEAD_MAX + 1.0f;
 
-            // Update analyzer's sample rate
-            sAnalyzer.set_sample_rate(sr);
+            // The sample rate of the analyzer is updated by configure_analyzer() when the
+            // analysis thread does not hold the analyzer
+            nAnPeriod       = dspu::millis_to_samples(sr, ANALYSIS_PERIOD);
+            bAnUpdate       = true;
+
             sCounter.set_sample_rate(sr, true);
+            TRACE_EVENT(TE_SAMPLE_RATE, sr);
+            TRACE_EVENT(TE_DELAY_CLEAR, TD_DRY);
 
             // Update channels
-            for (size_t i=0; i<nChannels; ++i)
+            for (size_t i=0; i<nStates; ++i)
             {
                 channel_t *c = &vChannels[i];
 
-                size_t max_lat      = dspu::millis_to_samples(MAX_SAMPLE_RATE, lk_latency*2 + c->sOver.max_latency()) + bins;
+                size_t max_lat      = dspu::millis_to_samples(MAX_SAMPLE_RATE, lk_latency*2 + c->sOver.max_latency()) + bins + BUFFER_SIZE;
 
                 c->sBypass.init(sr);
                 c->sOver.set_sample_rate(sr);
@@ -709,8 +974,9 @@ namespace lsp
                         c->sFFTXOver.set_handler(j, process_band, this, c);
                         c->sFFTScXOver.set_handler(j, process_sc_band, this, c);
                     }
-                    c->sFFTXOver.set_phase(float(i) / float(nChannels));
-                    c->sFFTScXOver.set_phase(float(i + 0.5f) / float(nChannels));
+                    update_fft_phase(c, i);
+                    if (i == 0)
+                        TRACE_EVENT(TE_XOVER_RESET, fft_rank);
                 }
 
                 // Update bands
@@ -728,6 +994,26 @@ namespace lsp
             // Force to rebuild plan and envelope boost
             nPlanSize       = 0;
             bEnvUpdate      = true;
+            invalidate_bands();
+        }
+
+        void mb_limiter::update_fft_phase(channel_t *c, size_t index)
+        {
+            // Channels and streams of the instance are staggered evenly, the instance shift
+            // stays within the half of interval between adjacent channels
+            const float shift   = PhaseRegistry::phase(nPhaseSlot) * 0.5f;
+            c->sFFTXOver.set_phase((float(index) + shift) / float(nStates));
+            c->sFFTScXOver.set_phase((float(index) + 0.5f + shift) / float(nStates));
+        }
+
+        void mb_limiter::invalidate_bands()
+        {
+            for (size_t i=0; i<nStates; ++i)
+            {
+                channel_t *c = &vChannels[i];
+                for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
+                    c->vBands[j].nXoverFlags    = 0;
+            }
         }
 
         size_t mb_limiter::decode_real_sample_rate(size_t mode)
@@ -926,6 +1212,12 @@ namespace lsp
 
         void mb_limiter::update_settings()
         {
+            // The pending buffer should be completed with the settings it has been computed with
+            flush_pipeline();
+
+            // Changes of parameters made by the host override changes made by post_param()
+            for (size_t i=0, n=vParamPorts.size(); i<n; ++i)
+                vParamPorts.uget(i)->sync();
 
             update_premix();
 
@@ -944,13 +1236,15 @@ namespace lsp
             size_t dither_bits          = decode_dithering(pDithering->value());
             if (real_srate != nRealSampleRate)
             {
-                for (size_t i=0; i<nChannels; ++i)
+                for (size_t i=0; i<nStates; ++i)
                 {
                     vChannels[i].sDataDelayMB.clear();
                     vChannels[i].sDataDelaySB.clear();
                 }
+                TRACE_EVENT(TE_DELAY_CLEAR, TD_DATA_MB | TD_DATA_SB);
                 nRealSampleRate     = real_srate;
                 rebuild_bands       = true;
+                invalidate_bands();
             }
 
             // Determine work mode: classic, modern or linear phase
@@ -960,19 +1254,32 @@ namespace lsp
             {
                 nMode               = xover;
                 rebuild_bands       = true;
-                for (size_t i=0; i<nChannels; ++i)
+                invalidate_bands();
+
+                // Linear-phase instances stagger their FFT frames against each other
+                if ((nMode == XOVER_LINEAR_PHASE) && (nPhaseSlot < 0))
+                    nPhaseSlot          = PhaseRegistry::acquire();
+                else if ((nMode != XOVER_LINEAR_PHASE) && (nPhaseSlot >= 0))
+                {
+                    PhaseRegistry::release(nPhaseSlot);
+                    nPhaseSlot          = -1;
+                }
+
+                for (size_t i=0; i<nStates; ++i)
                 {
                     channel_t *c        = &vChannels[i];
                     c->sDryDelay.clear();
                     c->sFFTXOver.clear();
                     c->sFFTScXOver.clear();
+                    update_fft_phase(c, i);
                 }
+                TRACE_EVENT(TE_DELAY_CLEAR, TD_DRY);
+                TRACE_EVENT(TE_XOVER_RESET, fft_rank);
             }
 
             // Store gain
             nScMode             = decode_sidechain_mode(pScMode->value());
             fInGain             = pInGain->value();
-            fOutGain            = pOutGain->value();
             fZoom               = pZoom->value();
 
             // Update frequency split bands
@@ -1020,9 +1327,10 @@ namespace lsp
                                 lsp::swap(vPlan[si], vPlan[sj]);
                         }
                 }
+                TRACE_EVENT(TE_PLAN_REBUILD, nPlanSize);
 
                 // Update plan for channels and basic band parameters (enabled, start and end frequency)
-                for (size_t i=0; i<nChannels; ++i)
+                for (size_t i=0; i<nStates; ++i)
                 {
                     channel_t *c    = &vChannels[i];
 
@@ -1045,7 +1353,7 @@ namespace lsp
             }
 
             // Configure channels (first pass)
-            for (size_t i=0; i<nChannels; ++i)
+            for (size_t i=0; i<nStates; ++i)
             {
                 channel_t *c    = &vChannels[i];
 
@@ -1057,15 +1365,12 @@ namespace lsp
                 c->sFFTScXOver.set_sample_rate(nRealSampleRate);
 
                 // Update analyzer settings
-                c->bFftIn       = c->pFftInEnable->value() >= 0.5f;
-                c->bFftOut      = c->pFftOutEnable->value() >= 0.5f;
+                c->bFftIn       = (c->pFftInEnable != NULL) && (c->pFftInEnable->value() >= 0.5f);
+                c->bFftOut      = (c->pFftOutEnable != NULL) && (c->pFftOutEnable->value() >= 0.5f);
 
-                sAnalyzer.enable_channel(c->nAnInChannel, c->bFftIn);
-                sAnalyzer.enable_channel(c->nAnOutChannel, c->bFftOut);
-
-                if (sAnalyzer.channel_active(c->nAnInChannel))
+                if (c->bFftIn)
                     active_channels ++;
-                if (sAnalyzer.channel_active(c->nAnOutChannel))
+                if (c->bFftOut)
                     active_channels ++;
 
                 // Update envelope boost filters
@@ -1109,18 +1414,10 @@ namespace lsp
                 }
             }
 
-            // Update analyzer parameters
-            sAnalyzer.set_reactivity(pReactivity->value());
-            if (pShift != NULL)
-                sAnalyzer.set_shift(pShift->value() * 100.0f);
-            sAnalyzer.set_activity(active_channels > 0);
-
-            // Update analyzer
-            if (sAnalyzer.needs_reconfiguration())
-            {
-                sAnalyzer.reconfigure();
-                sAnalyzer.get_frequencies(vFreqs, vIndexes, SPEC_FREQ_MIN, SPEC_FREQ_MAX, meta::mb_limiter::FFT_MESH_POINTS);
-            }
+            // Update analyzer parameters, deferred to process() if the analysis thread holds the analyzer
+            bAnActive       = active_channels > 0;
+            bAnUpdate       = true;
+            configure_analyzer();
 
             // Estimate lookahead buffer size
             float lookahead = pLookahead->value();
@@ -1129,7 +1426,7 @@ namespace lsp
             bool has_solo  = false;
 
             // Configure channels (second pass)
-            for (size_t i=0; i<nChannels; ++i)
+            for (size_t i=0; i<nStates; ++i)
             {
                 channel_t *c    = &vChannels[i];
 
@@ -1143,50 +1440,29 @@ namespace lsp
                 // Update settings for the post-limiter
                 limiter_t *l    = &c->sLimiter;
 
-                dspu::limiter_mode_t limiter_mode = decode_limiter_mode(l->pMode->value());
-                float thresh    = l->pThresh->value();
-                bool boost      = l->pBoost->value() >= 0.5f;
-
-                l->bEnabled     = l->pEnable->value() >= 0.5f;
-                l->fStereoLink  = (l->pStereoLink != NULL) ? l->pStereoLink->value() * 0.01f : 0.0f;
-                if ((boost) && (i == 0) && (l->bEnabled))
-                    fOutGain       /= thresh;
-
-                l->sLimit.set_mode(limiter_mode);
-                l->sLimit.set_sample_rate(nRealSampleRate);
-                l->sLimit.set_lookahead(lookahead);
-                l->sLimit.set_threshold(thresh, !boost);
-                l->sLimit.set_attack(l->pAttack->value());
-                l->sLimit.set_release(l->pRelease->value());
-                l->sLimit.set_knee(l->pAlrKneeLevel->value());
-                l->sLimit.set_alr_knee(dspu::db_to_gain(l->pAlrKneeSmooth->value()));
-                l->sLimit.set_alr(l->pAlrOn->value() >= 0.5f);
-                l->sLimit.set_alr_attack(l->pAlrAttack->value());
-                l->sLimit.set_alr_release(l->pAlrRelease->value());
+                l->bEnabled     = sLimiterPorts.pEnable->value() >= 0.5f;
+                l->fStereoLink  = ((i == 0) && (sLimiterPorts.pStereoLink != NULL)) ?
+                                  sLimiterPorts.pStereoLink->value() * 0.01f : 0.0f;
+                configure_limiter(l, &sLimiterPorts);
 
                 // Update compressor bands
                 for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
                 {
                     band_t *b       = &c->vBands[j];
                     limiter_t *l    = &b->sLimiter;
+                    const band_ports_t *bp  = &vBandPorts[j];
 
-                    limiter_mode    = decode_limiter_mode(l->pMode->value());
-                    bool enabled    = l->pEnable->value() >= 0.5f;
-                    thresh          = l->pThresh->value();
-                    boost           = l->pBoost->value() >= 0.5f;
+                    bool enabled    = bp->sLimiter.pEnable->value() >= 0.5f;
                     if (enabled && (j > 0))
                         enabled         = vSplits[j-1].bEnabled;
 
-                    b->fPreamp      = b->pPreamp->value();
-                    b->bMute        = b->pMute->value() >= 0.5f;
-                    b->bSolo        = (b->bEnabled) ? (b->pSolo->value() >= 0.5f) : false;
-                    b->fMakeup      = b->pMakeup->value();
+                    b->bMute        = bp->pMute->value() >= 0.5f;
+                    b->bSolo        = (b->bEnabled) ? (bp->pSolo->value() >= 0.5f) : false;
+                    update_band_gains(b, bp);
 
                     l->bEnabled     = enabled;
-                    l->fStereoLink  = (l->pStereoLink != NULL) ? l->pStereoLink->value() * 0.01f : 0.0f;
-
-                    if (boost)
-                        b->fMakeup     /= thresh;
+                    l->fStereoLink  = ((i == 0) && (bp->sLimiter.pStereoLink != NULL)) ?
+                                      bp->sLimiter.pStereoLink->value() * 0.01f : 0.0f;
 
                     if (b->bSolo)
                         has_solo            = true;
@@ -1195,7 +1471,11 @@ namespace lsp
                     c->sOver.set_mode(over_mode);
                     c->sOver.set_filtering(over_filtering);
                     if (c->sOver.modified())
+                    {
                         c->sOver.update_settings();
+                        if (i == 0)
+                            TRACE_EVENT(TE_OVERSAMPLER, ovs_mode);
+                    }
 
                     c->sScOver.set_mode(over_mode);
                     c->sScOver.set_filtering(false);
@@ -1203,22 +1483,13 @@ namespace lsp
                         c->sScOver.update_settings();
 
                     // Update settings for limiter
-                    l->sLimit.set_mode(limiter_mode);
-                    l->sLimit.set_sample_rate(nRealSampleRate);
-                    l->sLimit.set_lookahead(lookahead);
-                    l->sLimit.set_threshold(thresh, !boost);
-                    l->sLimit.set_attack(l->pAttack->value());
-                    l->sLimit.set_release(l->pRelease->value());
-                    l->sLimit.set_knee(l->pAlrKneeLevel->value());
-                    l->sLimit.set_alr_knee(dspu::db_to_gain(l->pAlrKneeSmooth->value()));
-                    l->sLimit.set_alr(l->pAlrOn->value() >= 0.5f);
-                    l->sLimit.set_alr_attack(l->pAlrAttack->value());
-                    l->sLimit.set_alr_release(l->pAlrRelease->value());
+                    configure_limiter(l, &bp->sLimiter);
                 }
             }
+            update_output_gain();
 
             // Configure channels (third pass)
-            for (size_t i=0; i<nChannels; ++i)
+            for (size_t i=0; i<nStates; ++i)
             {
                 channel_t *c    = &vChannels[i];
 
@@ -1244,12 +1515,26 @@ namespace lsp
                         band_t *b       = c->vPlan[j];
                         size_t band     = b - c->vBands;
 
+                        // Redesign only bands which edges or position in the plan have changed
+                        const uint32_t xover_flags  = XF_VALID |
+                            ((j == 0) ? XF_FIRST : 0) |
+                            ((j >= (nPlanSize - 1)) ? XF_LAST : 0) |
+                            ((nMode == XOVER_LINEAR_PHASE) ? XF_LINEAR : 0);
+                        if ((b->nXoverFlags == xover_flags) &&
+                            (b->fXoverStart == b->fFreqStart) &&
+                            (b->fXoverEnd == b->fFreqEnd))
+                            continue;
+
+                        b->nXoverFlags  = xover_flags;
+                        b->fXoverStart  = b->fFreqStart;
+                        b->fXoverEnd    = b->fFreqEnd;
                         b->sEq.set_sample_rate(nRealSampleRate);
 
                         // Check that band is enabled
                         b->bSync        = true;
 //                        lsp_trace("[%d]: %f - %f", int(j), b->fFreqStart, b->fFreqEnd);
-                        b->pFreqEnd->set_value(b->fFreqEnd);
+                        if (i == 0)
+                            vBandPorts[band].pFreqEnd->set_value(b->fFreqEnd);
 
                         if (nMode == XOVER_CLASSIC)
                         {
@@ -1275,9 +1560,14 @@ namespace lsp
 
                             b->sEq.set_params(1, &fp);
 
-                            // Update transfer function for equalizer
-                            b->sEq.freq_chart(vTr, vFreqs, meta::mb_limiter::FFT_MESH_POINTS);
-                            dsp::pcomplex_mod(b->vTrOut, vTr, meta::mb_limiter::FFT_MESH_POINTS);
+                            // Update transfer function for equalizer, it is the same for all channels
+                            if (i == 0)
+                            {
+                                b->sEq.freq_chart(vTr, vFreqs, meta::mb_limiter::FFT_MESH_POINTS);
+                                dsp::pcomplex_mod(b->vTrOut, vTr, meta::mb_limiter::FFT_MESH_POINTS);
+                            }
+                            else
+                                dsp::copy(b->vTrOut, vChannels[0].vBands[band].vTrOut, meta::mb_limiter::FFT_MESH_POINTS);
 
                             // Update filter parameters
                             fp.fGain        = 1.0f;
@@ -1341,9 +1631,11 @@ namespace lsp
                                 c->sFFTScXOver.disable_lpf(band);
                             }
 
-                            // Update transfer function
-                            c->sFFTScXOver.freq_chart(band, vTr, vFreqs, meta::mb_limiter::FFT_MESH_POINTS);
-                            dsp::copy(b->vTrOut, vTr, meta::mb_limiter::FFT_MESH_POINTS);
+                            // Update transfer function, it is the same for all channels
+                            if (i == 0)
+                                c->sFFTScXOver.freq_chart(band, b->vTrOut, vFreqs, meta::mb_limiter::FFT_MESH_POINTS);
+                            else
+                                dsp::copy(b->vTrOut, vChannels[0].vBands[band].vTrOut, meta::mb_limiter::FFT_MESH_POINTS);
                         }
                     } // nPlanSize
 
@@ -1360,200 +1652,786 @@ namespace lsp
             nEnvBoost               = env_boost;
             bEnvUpdate              = false;
 
+            // Request resources of enabled processing modes, modes are enabled once their
+            // resources are allocated
+            bParallelReq            = (pParallel != NULL) && (pParallel->value() >= 0.5f);
+            bBandParallelReq        = (pBandParallel != NULL) && (pBandParallel->value() >= 0.5f);
+            bPipelineReq            = (pPipeline != NULL) && (pPipeline->value() >= 0.5f) && (nStreams <= 1);
+            bTiledReq               = (pTiled != NULL) && (pTiled->value() >= 0.5f);
+            uint32_t request        = atomic_load(&nResRequest);
+            if (bParallelReq || bPipelineReq)
+                request                |= RES_WORKER;
+            if (bPipelineReq)
+                request                |= RES_PIPELINE;
+            if (bBandParallelReq)
+                request                |= RES_BAND_POOL;
+            if (bAnActive)
+                request                |= RES_ANALYSIS;
+            atomic_store(&nResRequest, request);
+            nResApplied             = atomic_load(&nResources);
+            request_resources();
+
+            update_modes();
+        }
+
+        void mb_limiter::update_modes()
+        {
+            // Pipelined processing delays the output by one buffer, it is not available for the bank of streams
+            const bool pipeline     = (bPipelineReq) && ((nResApplied & (RES_WORKER | RES_PIPELINE)) == (RES_WORKER | RES_PIPELINE));
+            if (pipeline != bPipeline)
+            {
+                bPipeline               = pipeline;
+                reset_pipeline();
+            }
+
             // Report latency
             size_t t_over           = vChannels[0].sOver.get_oversampling();
             size_t latency          = (nLookahead * 2) / t_over + vChannels[0].sOver.latency();
             size_t xover_latency    = (nMode == XOVER_LINEAR_PHASE) ? vChannels[0].sFFTXOver.latency()/t_over : 0;
-            set_latency(latency + xover_latency);
+            size_t pipe_latency     = (bPipeline) ? BUFFER_SIZE : 0;
+            set_latency(latency + xover_latency + pipe_latency);
 
-            for (size_t i=0; i<nChannels; ++i)
+        #ifdef LSP_INSTRUMENT
+            if (nTraceLatency != ssize_t(latency + xover_latency + pipe_latency))
+            {
+                nTraceLatency           = latency + xover_latency + pipe_latency;
+                TRACE_EVENT(TE_LATENCY, nTraceLatency);
+            }
+        #endif /* LSP_INSTRUMENT */
+
+            for (size_t i=0; i<nStates; ++i)
             {
                 channel_t *c            = &vChannels[i];
-                c->sDryDelay.set_delay(latency + xover_latency);
+                c->sDryDelay.set_delay(latency + xover_latency + pipe_latency);
             }
+
+            // Update parallel processing mode, the worker is busy in pipelined mode
+            bParallel               = (bParallelReq) && (nResApplied & RES_WORKER) && (!bPipeline);
+
+            // Channel processing worker may compute VCA gain concurrently, so parallel processing
+            // of bands is available only when channels are processed serially
+            bBandParallel           = (bBandParallelReq) && (nResApplied & RES_BAND_POOL) && (!bParallel);
+
+            // Cache-blocked processing requires the classic crossover: the FFT crossover processes
+            // the whole buffer at once. Other processing modes split the work between threads
+            bTiled                  = (bTiledReq) && (nMode == XOVER_CLASSIC) && (!bPipeline) && (!bParallel) && (!bBandParallel);
+            nTileSize               = select_tile_size();
+
+            // Select the serial processing routine specialized for the actual configuration
+            pProcess                = select_process();
         }
 
-        void mb_limiter::process_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count)
+        size_t mb_limiter::select_tile_size() const
         {
-            channel_t *c            = static_cast<channel_t *>(subject);
-            band_t *b               = &c->vBands[band];
+            const size_t max_size   = BUFFER_SIZE * vChannels[0].sOver.get_oversampling();
+            size_t size             = nTileRequest;
+            if (size <= 0)
+            {
+                // Buffers touched by the tile for each channel: sidechain, input, two temporary
+                // buffers, output data, VCA gain of each band and of the output limiter.
+                // The temporary buffer for stereo linking is shared by channels
+                const size_t buffers    = nChannels * (nPlanSize + 6) + 2;
+                size                    = nCacheSize / (buffers * sizeof(float));
+            }
 
-            // Store data to band's buffer
-            dsp::copy(&b->vDataBuf[sample], data, count);
+            size                   -= size % TILE_SIZE_STEP;
+            return lsp_limit(size, TILE_SIZE_MIN, max_size);
         }
 
-        void mb_limiter::process_sc_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count)
+        void mb_limiter::set_tile_size(size_t size)
         {
-            channel_t *c            = static_cast<channel_t *>(subject);
-            band_t *b               = &c->vBands[band];
+            nTileRequest            = size;
+        }
 
-            // Store data to band's buffer
-            dsp::mul_k3(&b->sLimiter.vVcaBuf[sample], data, b->fPreamp, count);
+        void mb_limiter::init_limiter_ports(limiter_ports_t *p)
+        {
+            p->pEnable          = NULL;
+            p->pAlrOn           = NULL;
+            p->pAlrAttack       = NULL;
+            p->pAlrRelease      = NULL;
+            p->pAlrKneeLevel    = NULL;
+            p->pAlrKneeSmooth   = NULL;
+
+            p->pMode            = NULL;
+            p->pThresh          = NULL;
+            p->pBoost           = NULL;
+            p->pAttack          = NULL;
+            p->pRelease         = NULL;
+            p->pInMeter         = NULL;
+            p->pStereoLink      = NULL;
         }
 
-        void mb_limiter::compute_multiband_vca_gain(channel_t *c, size_t samples)
+        void mb_limiter::configure_limiter(limiter_t *l, const limiter_ports_t *p)
         {
-            // Split single sidechain band into multiple
-            if (nMode == XOVER_CLASSIC)
-            {
-                for (size_t j=0; j<nPlanSize; ++j)
-                {
-                    band_t *b       = c->vPlan[j];
-                    b->sEq.process(b->sLimiter.vVcaBuf, c->vScBuf, samples);
-                    dsp::mul_k2(b->sLimiter.vVcaBuf, b->fPreamp, samples);
-                }
-            }
-            else // nMode == XOVER_LINEAR_PHASE
-                c->sFFTScXOver.process(c->vScBuf, samples);
+            l->sLimit.set_mode(decode_limiter_mode(p->pMode->value()));
+            l->sLimit.set_sample_rate(nRealSampleRate);
+            l->sLimit.set_lookahead(pLookahead->value());
+            l->sLimit.set_threshold(p->pThresh->value(), p->pBoost->value() < 0.5f);
+            l->sLimit.set_attack(p->pAttack->value());
+            l->sLimit.set_release(p->pRelease->value());
+            l->sLimit.set_knee(p->pAlrKneeLevel->value());
+            l->sLimit.set_alr_knee(dspu::db_to_gain(p->pAlrKneeSmooth->value()));
+            l->sLimit.set_alr(p->pAlrOn->value() >= 0.5f);
+            l->sLimit.set_alr_attack(p->pAlrAttack->value());
+            l->sLimit.set_alr_release(p->pAlrRelease->value());
+        }
 
-            // Estimate the VCA gain for each band
-            for (size_t j=0; j<nPlanSize; ++j)
-            {
-                band_t *b       = c->vPlan[j];
+        void mb_limiter::update_band_gains(band_t *b, const band_ports_t *p)
+        {
+            b->fPreamp          = p->pPreamp->value();
+            b->fMakeup          = p->pMakeup->value();
+            if (p->sLimiter.pBoost->value() >= 0.5f)
+                b->fMakeup         /= p->sLimiter.pThresh->value();
+        }
 
-                // Pass sidechain signal through the limiter
-                b->sLimiter.fInLevel    = lsp_max(b->sLimiter.fInLevel, dsp::abs_max(b->sLimiter.vVcaBuf, samples));
-                if (b->sLimiter.bEnabled)
-                    b->sLimiter.sLimit.process(b->sLimiter.vVcaBuf, b->sLimiter.vVcaBuf, samples);
-                else
-                    dsp::fill(b->sLimiter.vVcaBuf, (b->bMute) ? GAIN_AMP_M_INF_DB : GAIN_AMP_0_DB, samples);
-            }
+        void mb_limiter::update_output_gain()
+        {
+            fOutGain            = pOutGain->value();
+            if ((vChannels[0].sLimiter.bEnabled) && (sLimiterPorts.pBoost->value() >= 0.5f))
+                fOutGain           /= sLimiterPorts.pThresh->value();
         }
 
-        void mb_limiter::process_multiband_stereo_link(size_t samples)
+        bool mb_limiter::is_limiter_port(const limiter_ports_t *p, const plug::IPort *port)
         {
-            for (size_t i=0; i<nPlanSize; ++i)
-            {
-                band_t *left = vChannels[0].vPlan[i];
-                band_t *right= vChannels[1].vPlan[i];
-                perform_stereo_link(
-                    left->sLimiter.vVcaBuf,
-                    right->sLimiter.vVcaBuf,
-                    left->sLimiter.fStereoLink,
-                    samples);
-            }
+            return
+                (port == p->pAlrOn) ||
+                (port == p->pAlrAttack) ||
+                (port == p->pAlrRelease) ||
+                (port == p->pAlrKneeLevel) ||
+                (port == p->pAlrKneeSmooth) ||
+                (port == p->pMode) ||
+                (port == p->pThresh) ||
+                (port == p->pBoost) ||
+                (port == p->pAttack) ||
+                (port == p->pRelease);
         }
 
-        void mb_limiter::apply_multiband_vca_gain(channel_t *c, size_t samples)
+        void mb_limiter::apply_param(plug::IPort *port)
         {
-            // Post-process VCA gain
-            for (size_t i=0; i<nPlanSize; ++i)
+            // Gains
+            if (port == pInGain)
             {
-                band_t *b       = c->vPlan[i];
+                fInGain             = pInGain->value();
+                return;
+            }
+            if (port == pOutGain)
+            {
+                update_output_gain();
+                return;
+            }
 
-                // Compute gain reduction level
-                float reduction     = dsp::min(b->sLimiter.vVcaBuf, samples);
-                b->sLimiter.fReductionLevel  = lsp_min(b->sLimiter.fReductionLevel, reduction);
+            // Ports of limiters and bands are shared by all channels, so the change
+            // is applied to all channels
+            if (is_limiter_port(&sLimiterPorts, port))
+            {
+                for (size_t i=0; i<nStates; ++i)
+                    configure_limiter(&vChannels[i].sLimiter, &sLimiterPorts);
+                update_output_gain();
+                return;
+            }
+            if (port == sLimiterPorts.pStereoLink)
+            {
+                vChannels[0].sLimiter.fStereoLink = port->value() * 0.01f;
+                return;
+            }
 
-                // Check muting option
-                if (b->bMute)
-                    dsp::fill_zero(b->sLimiter.vVcaBuf, samples);
-                else
-                    dsp::mul_k2(b->sLimiter.vVcaBuf, b->fMakeup, samples);
+            for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
+            {
+                const band_ports_t *bp  = &vBandPorts[j];
+                const bool limiter  = is_limiter_port(&bp->sLimiter, port);
+                if ((limiter) || (port == bp->pPreamp) || (port == bp->pMakeup))
+                {
+                    for (size_t i=0; i<nStates; ++i)
+                    {
+                        band_t *cb          = &vChannels[i].vBands[j];
+                        if (limiter)
+                            configure_limiter(&cb->sLimiter, &bp->sLimiter);
+                        update_band_gains(cb, bp);
+                    }
+                    return;
+                }
+                if (port == bp->sLimiter.pStereoLink)
+                {
+                    vChannels[0].vBands[j].sLimiter.fStereoLink = port->value() * 0.01f;
+                    return;
+                }
             }
+        }
 
-            // Here, we apply VCA to input signal dependent on the input
-            // Apply delay to compensate lookahead feature
-            c->sDataDelayMB.process(vTmpBuf, c->vInBuf, samples);
+        size_t mb_limiter::apply_events(size_t samples)
+        {
+            size_t count        = samples;
 
-            // Originally, there is no signal
-            if (nMode == XOVER_CLASSIC)
+            for (const param_event_t *ev = sEvents.front(); ev != NULL; ev = sEvents.front())
             {
-                // Do the crossover stuff: first step
-                band_t *b       = c->vPlan[0];
-                // Filter frequencies from input
-                b->sPassFilter.process(vEnvBuf, vTmpBuf, samples);
-                // Apply VCA gain to band and add to output data buffer
-                dsp::mul3(c->vDataBuf, vEnvBuf, b->sLimiter.vVcaBuf, samples);
-                // Filter frequencies from input
-                b->sRejFilter.process(vTmpBuf, vTmpBuf, samples);
-
-                // Do the crossover stuff: other steps
-                for (size_t j=1; j<nPlanSize; ++j)
+                // The buffer ends where the next change takes effect
+                if (ev->nFrame > nFrame)
                 {
-                    b               = c->vPlan[j];
+                    count               = lsp_min(uint64_t(samples), ev->nFrame - nFrame);
+                    break;
+                }
 
-                    // Process the signal with all-pass
-                    b->sAllFilter.process(c->vDataBuf, c->vDataBuf, samples);
-                    // Filter frequencies from input
-                    b->sPassFilter.process(vEnvBuf, vTmpBuf, samples);
-                    // Apply VCA gain to band and add to output data buffer
-                    dsp::fmadd3(c->vDataBuf, vEnvBuf, b->sLimiter.vVcaBuf, samples);
-                    // Filter frequencies from input
-                    b->sRejFilter.process(vTmpBuf, vTmpBuf, samples);
+                // Only parameters that do not require the full update of settings are queued.
+                // The pending buffer of the pipeline should be completed with the settings
+                // it has been computed with before they change
+                if (ev->pPort != NULL)
+                {
+                    flush_pipeline();
+                    ev->pPort->set_value(ev->fValue);
+                    apply_param(ev->pPort);
                 }
+                sEvents.pop();
             }
-            else // nMode == XOVER_LINEAR_PHASE
+
+            return count;
+        }
+
+        void mb_limiter::wrap_param(plug::IPort **port)
+        {
+            if (*port == NULL)
+                return;
+
+            // The host port is used directly if the shadow can not be created,
+            // changes of the parameter can not be posted then
+            ParamPort *p        = new ParamPort(*port);
+            if (p == NULL)
+                return;
+            if (!vParamPorts.add(p))
+            {
+                delete p;
+                return;
+            }
+
+            *port               = p;
+        }
+
+        void mb_limiter::wrap_limiter_params(limiter_ports_t *p)
+        {
+            wrap_param(&p->pAlrOn);
+            wrap_param(&p->pAlrAttack);
+            wrap_param(&p->pAlrRelease);
+            wrap_param(&p->pAlrKneeLevel);
+            wrap_param(&p->pAlrKneeSmooth);
+            wrap_param(&p->pMode);
+            wrap_param(&p->pThresh);
+            wrap_param(&p->pBoost);
+            wrap_param(&p->pAttack);
+            wrap_param(&p->pRelease);
+            wrap_param(&p->pStereoLink);
+        }
+
+        bool mb_limiter::post_param(plug::IPort *port, float value, uint64_t frame)
+        {
+            for (size_t i=0, n=vParamPorts.size(); i<n; ++i)
+            {
+                ParamPort *p        = vParamPorts.uget(i);
+                if ((p == port) || (p->port() == port))
+                    return sEvents.post(p, value, frame);
+            }
+
+            return false;
+        }
+
+        void mb_limiter::process_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count)
+        {
+            channel_t *c            = static_cast<channel_t *>(subject);
+            band_t *b               = &c->vBands[band];
+
+            // Store data to band's buffer
+            dsp::copy(&b->vDataBuf[sample], data, count);
+        }
+
+        void mb_limiter::process_sc_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count)
+        {
+            channel_t *c            = static_cast<channel_t *>(subject);
+            band_t *b               = &c->vBands[band];
+
+            // Store data to band's buffer
+            dsp::mul_k3(&b->sLimiter.vVcaBuf[sample], data, b->fPreamp, count);
+        }
+
+        void mb_limiter::process_band_job(void *object, size_t index)
+        {
+            mb_limiter *self    = static_cast<mb_limiter *>(object);
+            channel_t *c        = self->pBandChannel;
+            self->compute_band_vca_gain(c, c->vPlan[index], 0, self->nBandSamples);
+        }
+
+        template <mb_limiter::xover_mode_t XOVER>
+        void mb_limiter::compute_band_vca_gain(channel_t *c, band_t *b, size_t off, size_t samples)
+        {
+            float *vca              = &b->sLimiter.vVcaBuf[off];
+
+            // Split single sidechain band into multiple
+            if (XOVER == XOVER_CLASSIC)
+            {
+                b->sEq.process(vca, &c->vScBuf[off], samples);
+                dsp::mul_k2(vca, b->fPreamp, samples);
+            }
+
+            // Pass sidechain signal through the limiter
+            b->sLimiter.fInLevel    = lsp_max(b->sLimiter.fInLevel, dsp::abs_max(vca, samples));
+            if (b->sLimiter.bEnabled)
+                b->sLimiter.sLimit.process(vca, vca, samples);
+            else
+                dsp::fill(vca, (b->bMute) ? GAIN_AMP_M_INF_DB : GAIN_AMP_0_DB, samples);
+        }
+
+        void mb_limiter::compute_band_vca_gain(channel_t *c, band_t *b, size_t off, size_t samples)
+        {
+            if (nMode == XOVER_CLASSIC)
+                compute_band_vca_gain<XOVER_CLASSIC>(c, b, off, samples);
+            else
+                compute_band_vca_gain<XOVER_LINEAR_PHASE>(c, b, off, samples);
+        }
+
+        template <mb_limiter::xover_mode_t XOVER>
+        void mb_limiter::compute_multiband_vca_gain(channel_t *c, size_t samples)
+        {
+            PROFILE_BEGIN(ts);
+
+            // The linear-phase crossover splits sidechain into bands at once
+            if (XOVER == XOVER_LINEAR_PHASE)
+            {
+                c->sFFTScXOver.process(c->vScBuf, samples);
+                PROFILE_SKIP(ts);
+            }
+
+            // Bands are independent until the VCA gain is applied, so they can be processed in parallel.
+            // Per-band profiling counters are not updated in this mode.
+            if ((bBandParallel) && (nPlanSize > 1))
+            {
+                pBandChannel    = c;
+                nBandSamples    = samples;
+                sBandPool.execute(nPlanSize);
+                return;
+            }
+
+            // Estimate the VCA gain for each band
+            for (size_t j=0; j<nPlanSize; ++j)
+            {
+                band_t *b       = c->vPlan[j];
+                compute_band_vca_gain<XOVER>(c, b, 0, samples);
+                PROFILE_BAND(ts, b - c->vBands);
+            }
+        }
+
+        void mb_limiter::compute_multiband_vca_gain(channel_t *c, size_t samples)
+        {
+            if (nMode == XOVER_CLASSIC)
+                compute_multiband_vca_gain<XOVER_CLASSIC>(c, samples);
+            else
+                compute_multiband_vca_gain<XOVER_LINEAR_PHASE>(c, samples);
+        }
+
+        void mb_limiter::process_multiband_stereo_link(size_t off, size_t samples)
+        {
+            for (size_t i=0; i<nPlanSize; ++i)
+            {
+                band_t *left = vChannels[0].vPlan[i];
+                band_t *right= vChannels[1].vPlan[i];
+                perform_stereo_link(
+                    &left->sLimiter.vVcaBuf[off],
+                    &right->sLimiter.vVcaBuf[off],
+                    vMbLinkBuf,
+                    left->sLimiter.fStereoLink,
+                    samples);
+            }
+        }
+
+        template <mb_limiter::xover_mode_t XOVER>
+        void mb_limiter::apply_multiband_vca_gain(channel_t *c, size_t off, size_t samples)
+        {
+            PROFILE_BEGIN(ts);
+
+            // Post-process VCA gain
+            for (size_t i=0; i<nPlanSize; ++i)
+            {
+                band_t *b       = c->vPlan[i];
+                float *vca      = &b->vVcaGain[off];
+
+                // Compute gain reduction level
+                float reduction     = dsp::min(vca, samples);
+                b->sLimiter.fReductionLevel  = lsp_min(b->sLimiter.fReductionLevel, reduction);
+
+                // Check muting option
+                if (b->bMute)
+                    dsp::fill_zero(vca, samples);
+                else
+                    dsp::mul_k2(vca, b->fMakeup, samples);
+                PROFILE_BAND(ts, b - c->vBands);
+            }
+
+            // Here, we apply VCA to input signal dependent on the input
+            // Apply delay to compensate lookahead feature
+            float *tmp          = &c->vTmpBuf[off];
+            float *env          = &c->vEnvBuf[off];
+            float *data         = &c->vDataBuf[off];
+            c->sDataDelayMB.process(tmp, &c->vApplyBuf[off], samples);
+            PROFILE_SKIP(ts);
+
+            // Originally, there is no signal
+            if (XOVER == XOVER_CLASSIC)
+            {
+                // The last band of the plan has no split above, all its filters are identity
+                // ones: the rest of the input is the band itself and the output of lower
+                // bands is already aligned in phase. So filters are not called for it
+                const size_t last   = nPlanSize - 1;
+
+                // Do the crossover stuff: first step
+                band_t *b       = c->vPlan[0];
+                if (last > 0)
+                {
+                    // Filter frequencies from input
+                    b->sPassFilter.process(env, tmp, samples);
+                    // Apply VCA gain to band and add to output data buffer
+                    dsp::mul3(data, env, &b->vVcaGain[off], samples);
+                    // Filter frequencies from input
+                    b->sRejFilter.process(tmp, tmp, samples);
+                }
+                else
+                    dsp::mul3(data, tmp, &b->vVcaGain[off], samples);
+                PROFILE_BAND(ts, b - c->vBands);
+
+                // Do the crossover stuff: other steps
+                for (size_t j=1; j<last; ++j)
+                {
+                    b               = c->vPlan[j];
+
+                    // Process the signal with all-pass
+                    b->sAllFilter.process(data, data, samples);
+                    // Filter frequencies from input
+                    b->sPassFilter.process(env, tmp, samples);
+                    // Apply VCA gain to band and add to output data buffer
+                    dsp::fmadd3(data, env, &b->vVcaGain[off], samples);
+                    // Filter frequencies from input
+                    b->sRejFilter.process(tmp, tmp, samples);
+                    PROFILE_BAND(ts, b - c->vBands);
+                }
+
+                // Do the crossover stuff: last step
+                if (last > 0)
+                {
+                    b               = c->vPlan[last];
+                    dsp::fmadd3(data, tmp, &b->vVcaGain[off], samples);
+                    PROFILE_BAND(ts, b - c->vBands);
+                }
+            }
+            else // XOVER == XOVER_LINEAR_PHASE
             {
-                c->sFFTXOver.process(vTmpBuf, samples);
+                // The FFT crossover writes bands from the start of band buffers,
+                // so the data is never split into tiles in this mode
+                c->sFFTXOver.process(tmp, samples);
+                PROFILE_SKIP(ts);
 
                 // First step
                 band_t *b       = c->vPlan[0];
-                dsp::mul3(c->vDataBuf, b->vDataBuf, b->sLimiter.vVcaBuf, samples);
+                dsp::mul3(data, b->vDataBuf, &b->vVcaGain[off], samples);
+                PROFILE_BAND(ts, b - c->vBands);
 
                 // Other steps: Apply VCA gain to band and add to output data buffer
                 for (size_t j=1; j<nPlanSize; ++j)
                 {
                     b               = c->vPlan[j];
-                    dsp::fmadd3(c->vDataBuf, b->vDataBuf, b->sLimiter.vVcaBuf, samples);
+                    dsp::fmadd3(data, b->vDataBuf, &b->vVcaGain[off], samples);
+                    PROFILE_BAND(ts, b - c->vBands);
                 }
             }
         }
 
-        void mb_limiter::perform_stereo_link(float *cl, float *cr, float link, size_t samples)
+        void mb_limiter::apply_multiband_vca_gain(channel_t *c, size_t off, size_t samples)
         {
-            for (size_t i=0; i<samples; ++i)
-            {
-                float gl = cl[i];
-                float gr = cr[i];
+            if (nMode == XOVER_CLASSIC)
+                apply_multiband_vca_gain<XOVER_CLASSIC>(c, off, samples);
+            else
+                apply_multiband_vca_gain<XOVER_LINEAR_PHASE>(c, off, samples);
+        }
 
-                if (gl < gr)
-                    cr[i] = gr + (gl - gr) * link;
-                else
-                    cl[i] = gl + (gr - gl) * link;
-            }
+        void mb_limiter::perform_stereo_link(float *cl, float *cr, float *buf, float link, size_t samples)
+        {
+            // Each gain is moved towards the minimum of both gains, so the lower gain
+            // stays the same. The form avoids branches and uses vectorized primitives
+            float *min          = buf;
+            float *delta        = &buf[samples];
+
+            dsp::pmin3(min, cl, cr, samples);
+            dsp::sub3(delta, min, cl, samples);
+            dsp::fmadd_k3(cl, delta, link, samples);
+            dsp::sub3(delta, min, cr, samples);
+            dsp::fmadd_k3(cr, delta, link, samples);
+        }
+
+        void mb_limiter::compute_single_band_vca_gain(channel_t *c, size_t off, size_t samples)
+        {
+            float *data             = &c->vDataBuf[off];
+            float *vca              = &c->sLimiter.vVcaBuf[off];
+
+            c->sLimiter.fInLevel    = lsp_max(c->sLimiter.fInLevel, dsp::abs_max(data, samples));
+            if (c->sLimiter.bEnabled)
+                c->sLimiter.sLimit.process(vca, data, samples);
+            else
+                dsp::fill(vca, GAIN_AMP_0_DB, samples);
+        }
+
+        void mb_limiter::process_single_band_stereo_link(size_t off, size_t samples)
+        {
+            limiter_t *left     = &vChannels[0].sLimiter;
+            limiter_t *right    = &vChannels[1].sLimiter;
+
+            perform_stereo_link(
+                &left->vVcaBuf[off],
+                &right->vVcaBuf[off],
+                vSbLinkBuf,
+                left->fStereoLink,
+                samples);
+        }
+
+        void mb_limiter::apply_single_band_vca_gain(channel_t *c, size_t off, size_t samples)
+        {
+            float *data                 = &c->vDataBuf[off];
+            float *vca                  = &c->sLimiter.vVcaBuf[off];
+
+            // Compute gain reduction level
+            float reduction             = dsp::min(vca, samples);
+            c->sLimiter.fReductionLevel = lsp_min(c->sLimiter.fReductionLevel, reduction);
+
+            // Apply lookahead and gain reduction to the input signal
+            c->sDataDelaySB.process(data, data, samples);
+            dsp::fmmul_k3(data, vca, fOutGain, samples);
         }
 
         void mb_limiter::process_single_band(size_t samples)
         {
             // Process the VCA signal for each channel
             for (size_t i=0; i<nChannels; ++i)
+                compute_single_band_vca_gain(&vChannels[i], 0, samples);
+
+            // Do stereo linking
+            if (nChannels > 1)
+                process_single_band_stereo_link(0, samples);
+
+            // Apply changes to the signal
+            for (size_t i=0; i<nChannels; ++i)
+                apply_single_band_vca_gain(&vChannels[i], 0, samples);
+        }
+
+        template <size_t CHANNELS, mb_limiter::xover_mode_t XOVER, mb_limiter::sc_mode_t SC_MODE>
+        void mb_limiter::process_buffer(size_t samples, size_t ovs_samples)
+        {
+            PROFILE_BEGIN(ts);
+
+            // Perform multiband processing
+            for (size_t i=0; i<CHANNELS; ++i)
+                oversample_channel<SC_MODE>(&vChannels[i], samples, ovs_samples);
+            PROFILE_STAGE(ts, ST_OVERSAMPLE);
+            for (size_t i=0; i<CHANNELS; ++i)
+                compute_multiband_vca_gain<XOVER>(&vChannels[i], ovs_samples);
+            PROFILE_STAGE(ts, ST_VCA_GAIN);
+            if (CHANNELS > 1)
+                process_multiband_stereo_link(0, ovs_samples);
+            PROFILE_STAGE(ts, ST_STEREO_LINK);
+            for (size_t i=0; i<CHANNELS; ++i)
+                apply_multiband_vca_gain<XOVER>(&vChannels[i], 0, ovs_samples);
+            PROFILE_STAGE(ts, ST_APPLY_VCA);
+
+            // Perform single-band processing
+            for (size_t i=0; i<CHANNELS; ++i)
+                compute_single_band_vca_gain(&vChannels[i], 0, ovs_samples);
+            if (CHANNELS > 1)
+                process_single_band_stereo_link(0, ovs_samples);
+            for (size_t i=0; i<CHANNELS; ++i)
+                apply_single_band_vca_gain(&vChannels[i], 0, ovs_samples);
+            PROFILE_STAGE(ts, ST_SINGLE_BAND);
+
+            // Post-process data
+            for (size_t i=0; i<CHANNELS; ++i)
+                downsample_channel(&vChannels[i], samples);
+            PROFILE_STAGE(ts, ST_DOWNSAMPLE);
+        }
+
+        mb_limiter::process_t mb_limiter::select_process() const
+        {
+            // Specializations indexed by number of channels, crossover mode and sidechain mode
+            static const process_t processors[] =
             {
-                channel_t *c = &vChannels[i];
+                &mb_limiter::process_buffer<1, XOVER_CLASSIC, SCM_INTERNAL>,
+                &mb_limiter::process_buffer<1, XOVER_CLASSIC, SCM_EXTERNAL>,
+                &mb_limiter::process_buffer<1, XOVER_CLASSIC, SCM_LINK>,
+                &mb_limiter::process_buffer<1, XOVER_LINEAR_PHASE, SCM_INTERNAL>,
+                &mb_limiter::process_buffer<1, XOVER_LINEAR_PHASE, SCM_EXTERNAL>,
+                &mb_limiter::process_buffer<1, XOVER_LINEAR_PHASE, SCM_LINK>,
+                &mb_limiter::process_buffer<2, XOVER_CLASSIC, SCM_INTERNAL>,
+                &mb_limiter::process_buffer<2, XOVER_CLASSIC, SCM_EXTERNAL>,
+                &mb_limiter::process_buffer<2, XOVER_CLASSIC, SCM_LINK>,
+                &mb_limiter::process_buffer<2, XOVER_LINEAR_PHASE, SCM_INTERNAL>,
+                &mb_limiter::process_buffer<2, XOVER_LINEAR_PHASE, SCM_EXTERNAL>,
+                &mb_limiter::process_buffer<2, XOVER_LINEAR_PHASE, SCM_LINK>,
+            };
 
-                c->sLimiter.fInLevel    = lsp_max(c->sLimiter.fInLevel, dsp::abs_max(c->vDataBuf, samples));
-                if (c->sLimiter.bEnabled)
-                    c->sLimiter.sLimit.process(c->sLimiter.vVcaBuf, c->vDataBuf, samples);
-                else
-                    dsp::fill(c->sLimiter.vVcaBuf, GAIN_AMP_0_DB, samples);
+            const size_t channels   = (nChannels > 1) ? 1 : 0;
+            const size_t xover      = (nMode == XOVER_LINEAR_PHASE) ? 1 : 0;
+            const size_t sc_mode    = lsp_min(nScMode, uint32_t(SCM_LINK));
+
+            return processors[(channels * 2 + xover) * 3 + sc_mode];
+        }
+
+        void mb_limiter::process_tiled(channel_t *c, size_t channels, size_t samples)
+        {
+            // All stages of multiband and single-band processing are performed for the tile
+            // before processing the next one, so the data of all bands stays in the L1 cache
+            // between stages. Filters, limiters and delays keep their state between calls,
+            // so the result does not depend on the size of the tile
+            for (size_t off=0; off < samples; )
+            {
+                const size_t count  = lsp_min(samples - off, nTileSize);
+
+                for (size_t i=0; i<channels; ++i)
+                {
+                    channel_t *tc       = &c[i];
+                    PROFILE_BEGIN(ts);
+                    for (size_t j=0; j<nPlanSize; ++j)
+                    {
+                        band_t *b           = tc->vPlan[j];
+                        compute_band_vca_gain(tc, b, off, count);
+                        PROFILE_BAND(ts, b - tc->vBands);
+                    }
+                }
+                if (channels > 1)
+                    process_multiband_stereo_link(off, count);
+                for (size_t i=0; i<channels; ++i)
+                    apply_multiband_vca_gain(&c[i], off, count);
+
+                for (size_t i=0; i<channels; ++i)
+                    compute_single_band_vca_gain(&c[i], off, count);
+                if (channels > 1)
+                    process_single_band_stereo_link(off, count);
+                for (size_t i=0; i<channels; ++i)
+                    apply_single_band_vca_gain(&c[i], off, count);
+
+                off                += count;
             }
+        }
 
-            // Do stereo linking
-            if (nChannels > 1)
+        void mb_limiter::process_channel_job(void *object, size_t stage)
+        {
+            mb_limiter *self    = static_cast<mb_limiter *>(object);
+            if (stage == CS_PIPELINE)
+                self->process_pipeline();
+            else
+                self->process_channel_stage(&self->vChannels[1], stage);
+        }
+
+        void mb_limiter::process_channel_stage(channel_t *c, size_t stage)
+        {
+            switch (stage)
             {
-                limiter_t *left     = &vChannels[0].sLimiter;
-                limiter_t *right    = &vChannels[1].sLimiter;
+                case CS_VCA_GAIN:
+                    oversample_channel(c, nStageSamples, nStageOvsSamples);
+                    compute_multiband_vca_gain(c, nStageOvsSamples);
+                    break;
+                case CS_APPLY_VCA:
+                    apply_multiband_vca_gain(c, 0, nStageOvsSamples);
+                    compute_single_band_vca_gain(c, 0, nStageOvsSamples);
+                    break;
+                case CS_OUTPUT:
+                    apply_single_band_vca_gain(c, 0, nStageOvsSamples);
+                    downsample_channel(c, nStageSamples);
+                    break;
+                default:
+                    break;
+            }
+        }
 
-                perform_stereo_link(
-                    left->vVcaBuf,
-                    right->vVcaBuf,
-                    left->fStereoLink,
-                    samples);
+        void mb_limiter::process_channels_parallel(size_t stage)
+        {
+            // The second channel is processed by the worker, the first one by the caller.
+            // join() acts as the barrier before the next link point.
+            sWorker.submit(stage);
+            process_channel_stage(&vChannels[0], stage);
+            sWorker.join();
+        }
+
+        void mb_limiter::process_pipeline()
+        {
+            // Apply VCA gain computed for the previous buffer, the data of the current buffer
+            // is written to the other half of double-buffered data by the DSP thread
+            for (size_t i=0; i<nChannels; ++i)
+                apply_multiband_vca_gain(&vChannels[i], 0, nPipeOvsSamples);
+            process_single_band(nPipeOvsSamples);
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                downsample_channel(c, nPipeSamples);
+                dsp::copy(&c->vPipeOut[nPipeFill], c->vData, nPipeSamples);
             }
+        }
+
+        void mb_limiter::advance_pipeline(size_t samples, size_t ovs_samples)
+        {
+            nPipeFill          += nPipeSamples;
 
-            // Apply changes to the signal
             for (size_t i=0; i<nChannels; ++i)
             {
-                channel_t *c = &vChannels[i];
+                channel_t *c        = &vChannels[i];
 
-                // Compute gain reduction level
-                float reduction             = dsp::min(c->sLimiter.vVcaBuf, samples);
-                c->sLimiter.fReductionLevel = lsp_min(c->sLimiter.fReductionLevel, reduction);
+                // The data just computed becomes the data for the next pipeline stage
+                lsp::swap(c->vInBuf, c->vApplyBuf);
+                for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
+                {
+                    band_t *b           = &c->vBands[j];
+                    lsp::swap(b->sLimiter.vVcaBuf, b->vVcaGain);
+                }
 
-                // Apply lookahead and gain reduction to the input signal
-                c->sDataDelaySB.process(c->vDataBuf, c->vDataBuf, samples);
-                dsp::fmmul_k3(c->vDataBuf, c->sLimiter.vVcaBuf, fOutGain, samples);
+                // Take the output delayed by one buffer
+                dsp::copy(c->vData, c->vPipeOut, samples);
+                dsp::move(c->vPipeOut, &c->vPipeOut[samples], nPipeFill - samples);
             }
+
+            nPipeFill          -= samples;
+            nPipeSamples        = samples;
+            nPipeOvsSamples     = ovs_samples;
+        }
+
+        void mb_limiter::flush_pipeline()
+        {
+            if ((!bPipeline) || (nPipeSamples <= 0))
+                return;
+
+            // Apply VCA gain to the pending buffer in the caller's thread, the output
+            // stays delayed by one buffer
+            process_pipeline();
+            nPipeFill          += nPipeSamples;
+            nPipeSamples        = 0;
+            nPipeOvsSamples     = 0;
+        }
+
+        void mb_limiter::reset_pipeline()
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+
+                // Restore the original buffers, then use the second ones in pipelined mode
+                if (c->vInBuf == c->vPipeInBuf)
+                    lsp::swap(c->vInBuf, c->vApplyBuf);
+                c->vApplyBuf        = (bPipeline) ? c->vPipeInBuf : c->vInBuf;
+
+                for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
+                {
+                    band_t *b           = &c->vBands[j];
+                    if (b->sLimiter.vVcaBuf == b->vPipeVcaBuf)
+                        lsp::swap(b->sLimiter.vVcaBuf, b->vVcaGain);
+                    b->vVcaGain         = (bPipeline) ? b->vPipeVcaBuf : b->sLimiter.vVcaBuf;
+                }
+
+                dsp::fill_zero(c->vPipeOut, BUFFER_SIZE);
+            }
+
+            // The pipeline starts with one buffer of silence at the output
+            nPipeSamples        = 0;
+            nPipeOvsSamples     = 0;
+            nPipeFill           = (bPipeline) ? BUFFER_SIZE : 0;
         }
 
         void mb_limiter::output_audio(size_t samples)
@@ -1710,40 +2588,128 @@ namespace lsp
                 }
             }
 
+            // Apply resources allocated in background
+            sync_resources();
+
+            // Apply analyzer settings that could not be applied in update_settings()
+            if (bAnUpdate)
+                configure_analyzer();
+
+        #ifdef LSP_INSTRUMENT
+            const uint64_t started      = read_cycles();
+            system::time_t started_time;
+            system::get_time(&started_time);
+            sTrace.begin_block();
+        #endif /* LSP_INSTRUMENT */
+
             // Do main processing
             for (size_t offset=0; offset < samples;)
             {
-                // Compute number of samples to process
-                const size_t count          = lsp_min(samples - offset, BUFFER_SIZE);
+                // Apply parameter changes that take effect at the current position,
+                // the buffer ends at the position of the next change
+                const size_t count          = lsp_min(apply_events(samples - offset), BUFFER_SIZE);
                 const size_t ovs_count      = count * vChannels[0].sScOver.get_oversampling();
+                PROFILE_BEGIN(ts);
 
                 // Pre-mix channels
                 for (size_t i=0; i<nChannels; ++i)
                     premix_channel(i, count);
+                PROFILE_STAGE(ts, ST_PREMIX);
 
-                // Perform multiband processing
-                oversample_data(count, ovs_count);
-                for (size_t i=0; i<nChannels; ++i)
-                    compute_multiband_vca_gain(&vChannels[i], ovs_count);
-                if (nChannels > 1)
-                    process_multiband_stereo_link(ovs_count);
-                for (size_t i=0; i<nChannels; ++i)
-                    apply_multiband_vca_gain(&vChannels[i], ovs_count);
-
-                // Perform single-band processing
-                process_single_band(ovs_count);
-
-                // Post-process data
-                downsample_data(count);
+                if (bPipeline)
+                {
+                    // The worker applies VCA gain to the previous buffer while the VCA gain
+                    // of the current buffer is computed, the output is delayed by one buffer.
+                    // Per-band profiling counters sum cycles of both threads in this mode
+                    const bool pending  = nPipeSamples > 0;
+                    if (pending)
+                        sWorker.submit(CS_PIPELINE);
+
+                    oversample_data(count, ovs_count);
+                    PROFILE_STAGE(ts, ST_OVERSAMPLE);
+                    for (size_t i=0; i<nChannels; ++i)
+                        compute_multiband_vca_gain(&vChannels[i], ovs_count);
+                    PROFILE_STAGE(ts, ST_VCA_GAIN);
+                    if (nChannels > 1)
+                        process_multiband_stereo_link(0, ovs_count);
+                    PROFILE_STAGE(ts, ST_STEREO_LINK);
+
+                    if (pending)
+                        sWorker.join();
+                    PROFILE_STAGE(ts, ST_APPLY_VCA);
+                    advance_pipeline(count, ovs_count);
+                    PROFILE_STAGE(ts, ST_DOWNSAMPLE);
+                }
+                else if (bParallel)
+                {
+                    // Channels are processed in parallel and synchronized at link points,
+                    // per-band profiling counters sum cycles of both threads in this mode
+                    nStageSamples       = count;
+                    nStageOvsSamples    = ovs_count;
+
+                    process_channels_parallel(CS_VCA_GAIN);
+                    PROFILE_STAGE(ts, ST_VCA_GAIN);
+                    process_multiband_stereo_link(0, ovs_count);
+                    PROFILE_STAGE(ts, ST_STEREO_LINK);
+                    process_channels_parallel(CS_APPLY_VCA);
+                    PROFILE_STAGE(ts, ST_APPLY_VCA);
+                    process_single_band_stereo_link(0, ovs_count);
+                    PROFILE_STAGE(ts, ST_SINGLE_BAND);
+                    process_channels_parallel(CS_OUTPUT);
+                    PROFILE_STAGE(ts, ST_DOWNSAMPLE);
+                }
+                else if (bTiled)
+                {
+                    // Stages are interleaved tile by tile, the whole multiband and single-band
+                    // processing is accounted as the VCA gain stage in this mode
+                    oversample_data(count, ovs_count);
+                    PROFILE_STAGE(ts, ST_OVERSAMPLE);
+                    process_tiled(vChannels, nChannels, ovs_count);
+                    PROFILE_STAGE(ts, ST_VCA_GAIN);
+                    downsample_data(count);
+                    PROFILE_STAGE(ts, ST_DOWNSAMPLE);
+                }
+                else
+                {
+                    // The routine is specialized for the number of channels, crossover and sidechain
+                    // modes, it accounts profiling stages by itself
+                    (this->*pProcess)(count, ovs_count);
+                    PROFILE_SKIP(ts);
+                }
 
                 // Output audio
                 output_audio(count);
+                PROFILE_STAGE(ts, ST_OUTPUT);
                 perform_analysis(count);
+                PROFILE_STAGE(ts, ST_ANALYSIS);
 
                 // Update pointers
-                offset += count;
+                offset             += count;
+                nFrame             += count;
             }
 
+        #ifdef LSP_INSTRUMENT
+            const uint64_t cycles       = read_cycles() - started;
+            sProfile.nCycles           += cycles;
+            sProfile.nSamples          += samples;
+            sProfile.nCalls            ++;
+            sProfile.fLoad              = (samples > 0) ? float(cycles) / float(samples) : 0.0f;
+            if (pProfile != NULL)
+                pProfile->set_value(sProfile.fLoad);
+
+            // Detect time overruns: the block should be processed faster than it is played
+            system::time_t finished_time;
+            system::get_time(&finished_time);
+            const int64_t elapsed_us    =
+                (int64_t(finished_time.seconds) - int64_t(started_time.seconds)) * 1000000 +
+                (int64_t(finished_time.nanos) - int64_t(started_time.nanos)) / 1000;
+            const int64_t budget_us     = (fSampleRate > 0) ? (int64_t(samples) * 1000000) / fSampleRate : 0;
+            if (elapsed_us > budget_us)
+                TRACE_EVENT(TE_OVERRUN, uint32_t(elapsed_us));
+            sTrace.end_block(samples);
+            flush_trace();
+        #endif /* LSP_INSTRUMENT */
+
             // Output FFT graphs to the UI
             sCounter.submit(samples);
 
@@ -1757,70 +2723,199 @@ namespace lsp
             sCounter.commit();
         }
 
-        void mb_limiter::oversample_data(size_t samples, size_t ovs_samples)
+        void mb_limiter::process_bank(const float * const *in, float * const *out, size_t samples)
         {
-            // Apply input gain if needed
-            for (size_t i=0; i<nChannels; ++i)
+            // Reset metering levels of all streams
+            for (size_t i=0; i<nStreams; ++i)
             {
                 channel_t *c        = &vChannels[i];
-                if (fInGain != GAIN_AMP_0_DB)
+
+                c->sLimiter.fInLevel        = GAIN_AMP_M_INF_DB;
+                c->sLimiter.fReductionLevel = GAIN_AMP_P_96_DB;
+
+                for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
                 {
-                    dsp::mul_k3(c->vData, c->vIn, fInGain, samples);
-                    c->sOver.upsample(c->vInBuf, c->vData, samples);
+                    band_t *b                   = &c->vBands[j];
+                    b->sLimiter.fInLevel        = GAIN_AMP_M_INF_DB;
+                    b->sLimiter.fReductionLevel = GAIN_AMP_P_96_DB;
+                }
+            }
+
+            // Apply resources allocated in background
+            sync_resources();
+
+            // Apply analyzer settings that could not be applied in update_settings()
+            if (bAnUpdate)
+                configure_analyzer();
+
+            for (size_t offset=0; offset < samples;)
+            {
+                // Apply parameter changes that take effect at the current position
+                const size_t count          = lsp_min(apply_events(samples - offset), BUFFER_SIZE);
+                const size_t ovs_count      = count * vChannels[0].sScOver.get_oversampling();
+
+                // Bind streams, the stream is the sidechain for itself
+                for (size_t i=0; i<nStreams; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+
+                    c->vIn              = const_cast<float *>(&in[i][offset]);
+                    c->vSc              = c->vIn;
+                    c->vShmIn           = NULL;
+                    c->vOut             = &out[i][offset];
                 }
-                else
-                    c->sOver.upsample(c->vInBuf, c->vIn, samples);
 
-                // Process sidechain signal and apply boosting
-                switch (nScMode)
+                if (bPipeline)
                 {
-                    case SCM_EXTERNAL:
+                    // Pipelined processing is available only for the single stream
+                    const bool pending  = nPipeSamples > 0;
+                    if (pending)
+                        sWorker.submit(CS_PIPELINE);
+
+                    oversample_channel(&vChannels[0], count, ovs_count);
+                    compute_multiband_vca_gain(&vChannels[0], ovs_count);
+
+                    if (pending)
+                        sWorker.join();
+                    advance_pipeline(count, ovs_count);
+                }
+                else
+                {
+                    // Streams are independent, so each one passes all stages at once
+                    // while its data is still in the cache
+                    for (size_t i=0; i<nStreams; ++i)
                     {
-                        if (c->vSc != NULL)
-                        {
-                            c->sScOver.upsample(c->vScBuf, c->vSc, samples);
-                            c->sScBoost.process(c->vScBuf, c->vScBuf, ovs_samples);
-                        }
+                        channel_t *c        = &vChannels[i];
+
+                        oversample_channel(c, count, ovs_count);
+                        if (bTiled)
+                            process_tiled(c, 1, ovs_count);
                         else
-                            dsp::fill_zero(c->vScBuf, ovs_samples);
-                        break;
-                    }
-                    case SCM_LINK:
-                    {
-                        if (c->vShmIn != NULL)
                         {
-                            c->sScOver.upsample(c->vScBuf, c->vShmIn, samples);
-                            c->sScBoost.process(c->vScBuf, c->vScBuf, ovs_samples);
+                            compute_multiband_vca_gain(c, ovs_count);
+                            apply_multiband_vca_gain(c, 0, ovs_count);
+                            compute_single_band_vca_gain(c, 0, ovs_count);
+                            apply_single_band_vca_gain(c, 0, ovs_count);
                         }
-                        else
-                            dsp::fill_zero(c->vScBuf, ovs_samples);
-                        break;
+                        downsample_channel(c, count);
                     }
-                    case SCM_INTERNAL:
-                    default:
-                        if (c->pSc == NULL)
-                        {
-                            c->sScOver.upsample(c->vScBuf, c->vSc, samples);
-                            c->sScBoost.process(c->vScBuf, c->vScBuf, ovs_samples);
-                        }
-                        else
-                            c->sScBoost.process(c->vScBuf, c->vInBuf, ovs_samples);
-                        break;
                 }
+
+                // Output audio
+                for (size_t i=0; i<nStreams; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+
+                    c->sDryDelay.process(c->vInBuf, c->vIn, count);
+                    c->sBypass.process(c->vOut, c->vInBuf, c->vData, count);
+                }
+
+                // The first stream is analyzed and metered
+                perform_analysis(count);
+
+                offset             += count;
+                nFrame             += count;
             }
+
+            // Output meters and FFT graphs once for the whole bank
+            sCounter.submit(samples);
+
+            output_meters();
+            output_fft_curves();
+
+            // Request for redraw
+            if ((pWrapper != NULL) && (sCounter.fired()))
+                pWrapper->query_display_draw();
+
+            sCounter.commit();
         }
 
-        void mb_limiter::downsample_data(size_t samples)
+        void mb_limiter::oversample_data(size_t samples, size_t ovs_samples)
         {
             for (size_t i=0; i<nChannels; ++i)
+                oversample_channel(&vChannels[i], samples, ovs_samples);
+        }
+
+        template <mb_limiter::sc_mode_t SC_MODE>
+        void mb_limiter::oversample_channel(channel_t *c, size_t samples, size_t ovs_samples)
+        {
+            // Apply input gain if needed. The sidechain buffer is overwritten below, so it
+            // serves as temporary buffer: vData may be in use by the pipeline stage
+            if (fInGain != GAIN_AMP_0_DB)
             {
-                channel_t *c        = &vChannels[i];
+                dsp::mul_k3(c->vScBuf, c->vIn, fInGain, samples);
+                c->sOver.upsample(c->vInBuf, c->vScBuf, samples);
+            }
+            else
+                c->sOver.upsample(c->vInBuf, c->vIn, samples);
+
+            // Process sidechain signal and apply boosting
+            switch (SC_MODE)
+            {
+                case SCM_EXTERNAL:
+                {
+                    if (c->vSc != NULL)
+                    {
+                        c->sScOver.upsample(c->vScBuf, c->vSc, samples);
+                        c->sScBoost.process(c->vScBuf, c->vScBuf, ovs_samples);
+                    }
+                    else
+                        dsp::fill_zero(c->vScBuf, ovs_samples);
+                    break;
+                }
+                case SCM_LINK:
+                {
+                    if (c->vShmIn != NULL)
+                    {
+                        c->sScOver.upsample(c->vScBuf, c->vShmIn, samples);
+                        c->sScBoost.process(c->vScBuf, c->vScBuf, ovs_samples);
+                    }
+                    else
+                        dsp::fill_zero(c->vScBuf, ovs_samples);
+                    break;
+                }
+                case SCM_INTERNAL:
+                default:
+                    if (c->pSc == NULL)
+                    {
+                        c->sScOver.upsample(c->vScBuf, c->vSc, samples);
+                        c->sScBoost.process(c->vScBuf, c->vScBuf, ovs_samples);
+                    }
+                    else
+                        c->sScBoost.process(c->vScBuf, c->vInBuf, ovs_samples);
+                    break;
+            }
+        }
 
-                c->sOver.downsample(c->vData, c->vDataBuf, samples);                // Downsample
-                c->sDither.process(c->vData, c->vData, samples);                    // Apply dithering
+        void mb_limiter::oversample_channel(channel_t *c, size_t samples, size_t ovs_samples)
+        {
+            switch (nScMode)
+            {
+                case SCM_EXTERNAL:
+                    oversample_channel<SCM_EXTERNAL>(c, samples, ovs_samples);
+                    break;
+                case SCM_LINK:
+                    oversample_channel<SCM_LINK>(c, samples, ovs_samples);
+                    break;
+                case SCM_INTERNAL:
+                default:
+                    oversample_channel<SCM_INTERNAL>(c, samples, ovs_samples);
+                    break;
             }
         }
 
+        void mb_limiter::downsample_data(size_t samples)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+                downsample_channel(&vChannels[i], samples);
+        }
+
+        void mb_limiter::downsample_channel(channel_t *c, size_t samples)
+        {
+            c->sOver.downsample(c->vData, c->vDataBuf, samples);                // Downsample
+            c->sDither.process(c->vData, c->vData, samples);                    // Apply dithering
+        }
+
         void mb_limiter::perform_analysis(size_t samples)
         {
             // Prepare processing
@@ -1835,9 +2930,250 @@ namespace lsp
                 c->pInMeter->set_value(dsp::abs_max(c->vInBuf, samples) * fInGain);
             }
 
-            // Perform processing
-            if (sAnalyzer.activity())
-                sAnalyzer.process(bufs, samples);
+            // Pass data to the analysis thread buffer by buffer. If the thread does not keep up,
+            // for example with large blocks of offline rendering, the pending data is analyzed
+            // by the DSP thread to free the ring
+            if (bAnActive)
+            {
+                if (sAnRing.space() < samples)
+                    process_analysis();
+                sAnRing.write(bufs, samples);
+            }
+            schedule_analysis(samples);
+        }
+
+        bool mb_limiter::configure_analyzer()
+        {
+            if (!atomic_cas(&nAnLock, 0, 1))
+                return false;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                sAnalyzer.enable_channel(c->nAnInChannel, c->bFftIn);
+                sAnalyzer.enable_channel(c->nAnOutChannel, c->bFftOut);
+            }
+
+            sAnalyzer.set_sample_rate(fSampleRate);
+            sAnalyzer.set_reactivity(pReactivity->value());
+            if (pShift != NULL)
+                sAnalyzer.set_shift(pShift->value() * 100.0f);
+            sAnalyzer.set_activity(bAnActive);
+
+            if (sAnalyzer.needs_reconfiguration())
+            {
+                sAnalyzer.reconfigure();
+                sAnalyzer.get_frequencies(vFreqs, vIndexes, SPEC_FREQ_MIN, SPEC_FREQ_MAX, meta::mb_limiter::FFT_MESH_POINTS);
+            }
+
+            atomic_store(&nAnLock, 0);
+            bAnUpdate               = false;
+
+            return true;
+        }
+
+        bool mb_limiter::process_analysis()
+        {
+            size_t pending          = sAnRing.pending();
+            if (pending <= 0)
+                return false;
+            if (!atomic_cas(&nAnLock, 0, 1))
+                return false;
+
+            const size_t lanes      = sAnRing.lanes();
+            float *bufs[4]          = { NULL, NULL, NULL, NULL };
+            const float *in[4]      = { NULL, NULL, NULL, NULL };
+            for (size_t i=0; i<lanes; ++i)
+            {
+                bufs[i]                 = &vAnBuf[i * BUFFER_SIZE];
+                in[i]                   = bufs[i];
+            }
+
+            // Process the data available at the moment
+            const bool active       = sAnalyzer.activity();
+            while (pending > 0)
+            {
+                const size_t count      = sAnRing.read(bufs, lsp_min(pending, BUFFER_SIZE));
+                if (count <= 0)
+                    break;
+                if (active)
+                    sAnalyzer.process(in, count);
+                pending                -= count;
+            }
+
+            // Publish spectrums
+            if (active)
+            {
+                float *dst              = sAnSpectrum.back();
+                for (size_t i=0; i<lanes; ++i)
+                {
+                    float *spectrum         = &dst[i * meta::mb_limiter::FFT_MESH_POINTS];
+                    if (sAnalyzer.channel_active(i))
+                        sAnalyzer.get_spectrum(i, spectrum, vIndexes, meta::mb_limiter::FFT_MESH_POINTS);
+                    else
+                        dsp::fill_zero(spectrum, meta::mb_limiter::FFT_MESH_POINTS);
+                }
+                sAnSpectrum.publish();
+            }
+
+            atomic_store(&nAnLock, 0);
+            return true;
+        }
+
+        void mb_limiter::schedule_analysis(size_t samples)
+        {
+            // Perform analysis in the DSP thread if there is no analysis thread
+            if (!(nResApplied & RES_ANALYSIS))
+            {
+                process_analysis();
+                return;
+            }
+
+            // The thread sleeps while the analyzer is inactive
+            if (!bAnActive)
+                return;
+            nAnSamples         += samples;
+            if (nAnSamples < nAnPeriod)
+                return;
+
+            nAnSamples          = 0;
+            sAnWake.post();
+        }
+
+        void mb_limiter::request_resources()
+        {
+            if ((atomic_load(&nResRequest) & (~atomic_load(&nResTried))) == 0)
+                return;
+
+            if (pResTask == NULL)
+                return;
+            if (pResTask->completed())
+                pResTask->reset();
+            if (!pResTask->idle())
+                return;
+
+            // Hosts without executor call update_resources() by themselves
+            ipc::IExecutor *executor = (pWrapper != NULL) ? pWrapper->executor() : NULL;
+            if (executor != NULL)
+                executor->submit(pResTask);
+        }
+
+        void mb_limiter::sync_resources()
+        {
+            // Only processing modes depend on the set of available resources, the rest
+            // of settings stays the same
+            const uint32_t resources    = atomic_load(&nResources);
+            if (resources != nResApplied)
+            {
+                nResApplied             = resources;
+                update_modes();
+            }
+            else
+                request_resources();
+        }
+
+        bool mb_limiter::update_resources()
+        {
+            const uint32_t tried    = atomic_load(&nResTried);
+            const uint32_t pending  = atomic_load(&nResRequest) & (~tried);
+            if (pending == 0)
+                return false;
+
+            uint32_t resources      = atomic_load(&nResources);
+
+            // The worker processes the second channel of stereo versions in parallel mode
+            // or applies the VCA gain in pipelined mode
+            if (pending & RES_WORKER)
+            {
+                if (sWorker.start(process_channel_job, this) == STATUS_OK)
+                    resources              |= RES_WORKER;
+                else
+                    lsp_warn("Could not start worker thread, parallel and pipelined processing is not available");
+            }
+
+            // Bands are processed by the pool of threads shared by all instances, the DSP thread
+            // takes part in processing too
+            if (pending & RES_BAND_POOL)
+            {
+                const size_t cpus   = ipc::Thread::system_cpus();
+                const size_t band_threads = (cpus > 1) ? lsp_min(cpus - 1, BAND_THREADS) : 0;
+                if ((band_threads > 0) && (sBandPool.start(band_threads, process_band_job, this) == STATUS_OK))
+                    resources              |= RES_BAND_POOL;
+                else
+                    lsp_warn("Could not start band processing threads, parallel processing of bands is not available");
+            }
+
+            // Second buffers of the input data and VCA gains for pipelined processing
+            if (pending & RES_PIPELINE)
+            {
+                const size_t szof_ovs_buf   = BUFFER_SIZE * sizeof(float) * meta::mb_limiter::OVERSAMPLING_MAX;
+                const size_t to_alloc       =
+                    nChannels * (
+                        szof_ovs_buf +                      // vPipeInBuf
+                        meta::mb_limiter::BANDS_MAX * szof_ovs_buf  // vPipeVcaBuf
+                    );
+
+                uint8_t *ptr        = alloc_aligned<uint8_t>(pPipeData, to_alloc);
+                if (ptr != NULL)
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        channel_t *c        = &vChannels[i];
+                        c->vPipeInBuf       = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
+                        for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
+                            c->vBands[j].vPipeVcaBuf    = advance_ptr_bytes<float>(ptr, szof_ovs_buf);
+                    }
+                    resources          |= RES_PIPELINE;
+                }
+                else
+                    lsp_warn("Could not allocate buffers, pipelined processing is not available");
+            }
+
+            // Spectrum analysis is performed by the dedicated thread which sleeps until
+            // the DSP thread passes data to it
+            if (pending & RES_ANALYSIS)
+            {
+                atomic_store(&nAnShutdown, 0);
+                ipc::Thread *thread = new ipc::Thread(analysis_thread_proc, this);
+                if ((thread != NULL) && (thread->start() != STATUS_OK))
+                {
+                    delete thread;
+                    thread              = NULL;
+                }
+
+                if (thread != NULL)
+                {
+                    pAnThread           = thread;
+                    resources          |= RES_ANALYSIS;
+                }
+                else
+                    lsp_warn("Could not start analysis thread, analysis will be performed by the DSP thread");
+            }
+
+            // Failed resources are not requested again
+            atomic_store(&nResTried, tried | pending);
+            atomic_store(&nResources, resources);
+
+            return true;
+        }
+
+        status_t mb_limiter::analysis_thread_proc(void *arg)
+        {
+            mb_limiter *self    = static_cast<mb_limiter *>(arg);
+            return self->run_analysis();
+        }
+
+        status_t mb_limiter::run_analysis()
+        {
+            while (true)
+            {
+                sAnWake.wait();
+                if (atomic_load(&nAnShutdown) != 0)
+                    break;
+                process_analysis();
+            }
+
+            return STATUS_OK;
         }
 
         void mb_limiter::output_meters()
@@ -1865,7 +3201,7 @@ namespace lsp
                 limiter_t *left     = &vChannels[0].sLimiter;
                 limiter_t *right    = &vChannels[1].sLimiter;
                 float in_gain       = (left->bEnabled) ? lsp_max(left->fInLevel, right->fInLevel) : GAIN_AMP_M_INF_DB;
-                left->pInMeter->set_value(in_gain);
+                sLimiterPorts.pInMeter->set_value(in_gain);
 
                 for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
                 {
@@ -1873,31 +3209,35 @@ namespace lsp
                     left                = &vChannels[0].vBands[j].sLimiter;
                     right               = &vChannels[1].vBands[j].sLimiter;
                     in_gain             = ((b->bEnabled) && (left->bEnabled)) ? lsp_max(left->fInLevel, right->fInLevel) : GAIN_AMP_M_INF_DB;
-                    left->pInMeter->set_value(in_gain);
+                    vBandPorts[j].sLimiter.pInMeter->set_value(in_gain);
                 }
             }
             else
             {
                 limiter_t *mid      = &vChannels[0].sLimiter;
                 float in_gain       = (mid->bEnabled) ? mid->fInLevel : GAIN_AMP_M_INF_DB;
-                mid->pInMeter->set_value(in_gain);
+                sLimiterPorts.pInMeter->set_value(in_gain);
 
                 for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
                 {
                     band_t *b           = &vChannels[0].vBands[j];
                     mid                 = &vChannels[0].vBands[j].sLimiter;
                     in_gain             = ((b->bEnabled) && (mid->bEnabled)) ? mid->fInLevel : GAIN_AMP_M_INF_DB;
-                    mid->pInMeter->set_value(in_gain);
+                    vBandPorts[j].sLimiter.pInMeter->set_value(in_gain);
                 }
             }
         }
 
         void mb_limiter::output_fft_curves()
         {
+            // Latest spectrums published by the analysis thread
+            const float *spectrum   = sAnSpectrum.front();
+
             // Output filter curve for each band
             for (size_t j=0; j<meta::mb_limiter::BANDS_MAX; ++j)
             {
                 band_t *b           = &vChannels[0].vBands[j];
+                plug::IPort *graph  = vBandPorts[j].pBandGraph;
 
                 // FFT spectrogram
                 plug::mesh_t *mesh  = NULL;
@@ -1905,7 +3245,7 @@ namespace lsp
                 // FFT curve
                 if (b->bSync)
                 {
-                    mesh                = (b->pBandGraph != NULL) ? b->pBandGraph->buffer<plug::mesh_t>() : NULL;
+                    mesh                = (graph != NULL) ? graph->buffer<plug::mesh_t>() : NULL;
                     if ((mesh != NULL) && (mesh->isEmpty()))
                     {
                         // Add extra points
@@ -1948,7 +3288,7 @@ namespace lsp
                 plug::mesh_t *mesh            = (c->pFftIn != NULL) ? c->pFftIn->buffer<plug::mesh_t>() : NULL;
                 if ((mesh != NULL) && (mesh->isEmpty()))
                 {
-                    if ((c->bFftIn) && (sAnalyzer.channel_active(c->nAnInChannel)))
+                    if ((c->bFftIn) && (spectrum != NULL))
                     {
                         // Add extra points
                         mesh->pvData[0][0] = SPEC_FREQ_MIN*0.5f;
@@ -1958,8 +3298,8 @@ namespace lsp
 
                         // Copy frequency points
                         dsp::copy(&mesh->pvData[0][1], vFreqs, meta::mb_limiter::FFT_MESH_POINTS);
-                        sAnalyzer.get_spectrum(c->nAnInChannel, &mesh->pvData[1][1], vIndexes, meta::mb_limiter::FFT_MESH_POINTS);
-                        dsp::mul_k2(&mesh->pvData[1][1], fInGain, meta::mb_limiter::FFT_MESH_POINTS);
+                        dsp::mul_k3(&mesh->pvData[1][1], &spectrum[c->nAnInChannel * meta::mb_limiter::FFT_MESH_POINTS],
+                            fInGain, meta::mb_limiter::FFT_MESH_POINTS);
 
                         // Mark mesh containing data
                         mesh->data(2, meta::mb_limiter::FFT_MESH_POINTS + 2);
@@ -1972,11 +3312,12 @@ namespace lsp
                 mesh            = (c->pFftOut != NULL) ? c->pFftOut->buffer<plug::mesh_t>() : NULL;
                 if ((mesh != NULL) && (mesh->isEmpty()))
                 {
-                    if ((c->bFftOut) && (sAnalyzer.channel_active(c->nAnOutChannel)))
+                    if ((c->bFftOut) && (spectrum != NULL))
                     {
                         // Copy frequency points
                         dsp::copy(mesh->pvData[0], vFreqs, meta::mb_limiter::FFT_MESH_POINTS);
-                        sAnalyzer.get_spectrum(c->nAnOutChannel, mesh->pvData[1], vIndexes, meta::mb_limiter::FFT_MESH_POINTS);
+                        dsp::copy(mesh->pvData[1], &spectrum[c->nAnOutChannel * meta::mb_limiter::FFT_MESH_POINTS],
+                            meta::mb_limiter::FFT_MESH_POINTS);
 
                         // Mark mesh containing data
                         mesh->data(2, meta::mb_limiter::FFT_MESH_POINTS);
@@ -2117,26 +3458,33 @@ namespace lsp
                 v->write("fInLevel", l->fInLevel);
                 v->write("fReductionLevel", l->fReductionLevel);
                 v->write("vVcaBuf", l->vVcaBuf);
-
-                v->write("pEnable", l->pEnable);
-                v->write("pAlrOn", l->pAlrOn);
-                v->write("pAlrAttack", l->pAlrAttack);
-                v->write("pAlrRelease", l->pAlrRelease);
-                v->write("pAlrKneeLevel", l->pAlrKneeLevel);
-                v->write("pAlrKneeSmooth", l->pAlrKneeSmooth);
-
-                v->write("pMode", l->pMode);
-                v->write("pThresh", l->pThresh);
-                v->write("pBoost", l->pBoost);
-                v->write("pAttack", l->pAttack);
-                v->write("pRelease", l->pRelease);
-                v->write("pInMeter", l->pInMeter);
-                v->write("pStereoLink", l->pStereoLink);
                 v->write("pReductionMeter", l->pReductionMeter);
             }
             v->end_object();
         }
 
+        void mb_limiter::dump(dspu::IStateDumper *v, const char *name, const limiter_ports_t *p)
+        {
+            v->begin_object(name, p, sizeof(limiter_ports_t));
+            {
+                v->write("pEnable", p->pEnable);
+                v->write("pAlrOn", p->pAlrOn);
+                v->write("pAlrAttack", p->pAlrAttack);
+                v->write("pAlrRelease", p->pAlrRelease);
+                v->write("pAlrKneeLevel", p->pAlrKneeLevel);
+                v->write("pAlrKneeSmooth", p->pAlrKneeSmooth);
+
+                v->write("pMode", p->pMode);
+                v->write("pThresh", p->pThresh);
+                v->write("pBoost", p->pBoost);
+                v->write("pAttack", p->pAttack);
+                v->write("pRelease", p->pRelease);
+                v->write("pInMeter", p->pInMeter);
+                v->write("pStereoLink", p->pStereoLink);
+            }
+            v->end_object();
+        }
+
         void mb_limiter::dump(dspu::IStateDumper *v) const
         {
             v->write_object("sAnalyzer", &sAnalyzer);
@@ -2168,9 +3516,27 @@ namespace lsp
             v->end_object();
 
             v->write("nChannels", nChannels);
+            v->write("nStreams", nStreams);
+            v->write("nStates", nStates);
             v->write("nMode", nMode);
             v->write("bSidechain", bSidechain);
+            v->write("bParallel", bParallel);
+            v->write("bBandParallel", bBandParallel);
+            v->write("bPipeline", bPipeline);
+            v->write("bTiled", bTiled);
+            v->write("bParallelReq", bParallelReq);
+            v->write("bBandParallelReq", bBandParallelReq);
+            v->write("bPipelineReq", bPipelineReq);
+            v->write("bTiledReq", bTiledReq);
+            v->write("pResTask", pResTask);
+            v->write("nResRequest", nResRequest);
+            v->write("nResTried", nResTried);
+            v->write("nResources", nResources);
+            v->write("nResApplied", nResApplied);
             v->write("bEnvUpdate", bEnvUpdate);
+            v->write("bAnUpdate", bAnUpdate);
+            v->write("bAnActive", bAnActive);
+            v->write("pAnThread", pAnThread);
             v->write("nScMode", nScMode);
             v->write("fInGain", fInGain);
             v->write("fOutGain", fOutGain);
@@ -2178,11 +3544,23 @@ namespace lsp
             v->write("nRealSampleRate", nRealSampleRate);
             v->write("nEnvBoost", nEnvBoost);
             v->write("nLookahead", nLookahead);
-
-            v->begin_array("vChannels", vChannels, nChannels);
+            v->write("nStageSamples", nStageSamples);
+            v->write("nStageOvsSamples", nStageOvsSamples);
+            v->write("nPhaseSlot", nPhaseSlot);
+            v->write("pBandChannel", pBandChannel);
+            v->write("nBandSamples", nBandSamples);
+            v->write("nPipeSamples", nPipeSamples);
+            v->write("nPipeOvsSamples", nPipeOvsSamples);
+            v->write("nPipeFill", nPipeFill);
+            v->write("nTileSize", nTileSize);
+            v->write("nTileRequest", nTileRequest);
+            v->write("nCacheSize", nCacheSize);
+            v->write("nFrame", nFrame);
+
+            v->begin_array("vChannels", vChannels, nStates);
             {
                 //channel_t              *vChannels;          // Channels
-                for (size_t i=0; i<nChannels; ++i)
+                for (size_t i=0; i<nStates; ++i)
                 {
                     const channel_t *c      = &vChannels[i];
                     v->begin_object(c, sizeof(channel_t));
@@ -2219,16 +3597,14 @@ namespace lsp
                                 v->write("fFreqStart", b->fFreqStart);
                                 v->write("fFreqEnd", b->fFreqEnd);
                                 v->write("fMakeup", b->fMakeup);
+                                v->write("fXoverStart", b->fXoverStart);
+                                v->write("fXoverEnd", b->fXoverEnd);
+                                v->write("nXoverFlags", b->nXoverFlags);
+                                v->write("vVcaGain", b->vVcaGain);
+                                v->write("vPipeVcaBuf", b->vPipeVcaBuf);
 
                                 v->write("vDataBuf", b->vDataBuf);
                                 v->write("vTrOut", b->vTrOut);
-
-                                v->write("pFreqEnd", b->pFreqEnd);
-                                v->write("pSolo", b->pSolo);
-                                v->write("pMute", b->pMute);
-                                v->write("pPreamp", b->pPreamp);
-                                v->write("pMakeup", b->pMakeup);
-                                v->write("pBandGraph", b->pBandGraph);
                             }
                         }
                         v->end_array();
@@ -2242,8 +3618,13 @@ namespace lsp
                         v->write("vOut", c->vOut);
                         v->write("vData", c->vData);
                         v->write("vInBuf", c->vInBuf);
+                        v->write("vApplyBuf", c->vApplyBuf);
+                        v->write("vPipeInBuf", c->vPipeInBuf);
+                        v->write("vPipeOut", c->vPipeOut);
                         v->write("vScBuf", c->vScBuf);
                         v->write("vDataBuf", c->vDataBuf);
+                        v->write("vTmpBuf", c->vTmpBuf);
+                        v->write("vEnvBuf", c->vEnvBuf);
                         v->write("vTrOut", c->vTrOut);
                         v->write("bFftIn", c->bFftIn);
                         v->write("bFftOut", c->bFftOut);
@@ -2267,13 +3648,14 @@ namespace lsp
             }
             v->end_array();
 
-            v->write("vTmpBuf", vTmpBuf);
-            v->write("vEnvBuf", vEnvBuf);
             v->write("vIndexes", vIndexes);
             v->write("vFreqs", vFreqs);
             v->write("vTr", vTr);
             v->write("vTrTmp", vTrTmp);
             v->write("vFc", vFc);
+            v->write("vAnBuf", vAnBuf);
+            v->write("vMbLinkBuf", vMbLinkBuf);
+            v->write("vSbLinkBuf", vSbLinkBuf);
             v->write("pIDisplay", pIDisplay);
 
             v->begin_array("vSplits", vSplits, meta::mb_limiter::BANDS_MAX-1);
@@ -2293,6 +3675,28 @@ namespace lsp
             }
             v->end_array();
 
+            dump(v, "sLimiterPorts", &sLimiterPorts);
+            v->begin_array("vBandPorts", vBandPorts, meta::mb_limiter::BANDS_MAX);
+            {
+                for (size_t i=0; i<meta::mb_limiter::BANDS_MAX; ++i)
+                {
+                    const band_ports_t *b = &vBandPorts[i];
+                    v->begin_object(b, sizeof(band_ports_t));
+                    {
+                        dump(v, "sLimiter", &b->sLimiter);
+
+                        v->write("pFreqEnd", b->pFreqEnd);
+                        v->write("pSolo", b->pSolo);
+                        v->write("pMute", b->pMute);
+                        v->write("pPreamp", b->pPreamp);
+                        v->write("pMakeup", b->pMakeup);
+                        v->write("pBandGraph", b->pBandGraph);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+
             v->writev("vPlan", vPlan, meta::mb_limiter::BANDS_MAX);
             v->write("nPlanSize", nPlanSize);
 
@@ -2308,8 +3712,32 @@ namespace lsp
             v->write("pReactivity", pReactivity);
             v->write("pShift", pShift);
             v->write("pScMode", pScMode);
+            v->write("pParallel", pParallel);
+            v->write("pBandParallel", pBandParallel);
+            v->write("pPipeline", pPipeline);
+            v->write("pTiled", pTiled);
 
             v->write("pData", pData);
+            v->write("pPipeData", pPipeData);
+
+        #ifdef LSP_INSTRUMENT
+            v->begin_object("sProfile", &sProfile, sizeof(profile_t));
+            {
+                v->begin_object("vStages", sProfile.vStages, sizeof(sProfile.vStages));
+                {
+                    for (size_t i=0; i<ST_TOTAL; ++i)
+                        v->write(profile_stage_names[i], sProfile.vStages[i]);
+                }
+                v->end_object();
+                v->writev("vBands", sProfile.vBands, meta::mb_limiter::BANDS_MAX);
+                v->write("nCycles", sProfile.nCycles);
+                v->write("nSamples", sProfile.nSamples);
+                v->write("nCalls", sProfile.nCalls);
+                v->write("fLoad", sProfile.fLoad);
+            }
+            v->end_object();
+            v->write("pProfile", pProfile);
+        #endif /* LSP_INSTRUMENT */
         }
 
     } /* namespace plugins */
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/bits.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#include <private/util/AnalysisQueue.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /* The flag of the shared frame buffer that indicates that it contains the fresh frame */
+        static constexpr uint32_t FRAME_FRESH   = 0x4;
+        static constexpr uint32_t FRAME_INDEX   = 0x3;
+
+        //---------------------------------------------------------------------
+        SampleRing::SampleRing()
+        {
+            vData       = NULL;
+            nLanes      = 0;
+            nCapacity   = 0;
+            nHead       = 0;
+            nTail       = 0;
+            nDropped    = 0;
+        }
+
+        SampleRing::~SampleRing()
+        {
+            destroy();
+        }
+
+        status_t SampleRing::init(size_t lanes, size_t capacity)
+        {
+            destroy();
+
+            const size_t cap    = size_t(1) << int_log2(lsp_max(capacity, size_t(2)) * 2 - 1);
+            vData               = static_cast<float *>(malloc(cap * lanes * sizeof(float)));
+            if (vData == NULL)
+                return STATUS_NO_MEM;
+
+            nLanes              = lanes;
+            nCapacity           = cap;
+            atomic_store(&nHead, 0);
+            atomic_store(&nTail, 0);
+            atomic_store(&nDropped, 0);
+
+            return STATUS_OK;
+        }
+
+        void SampleRing::destroy()
+        {
+            if (vData != NULL)
+            {
+                free(vData);
+                vData       = NULL;
+            }
+            nLanes      = 0;
+            nCapacity   = 0;
+        }
+
+        size_t SampleRing::write(const float * const *src, size_t count)
+        {
+            if (vData == NULL)
+                return 0;
+
+            const uatomic_t head    = atomic_load(&nHead);
+            const uatomic_t tail    = atomic_load(&nTail);
+            const size_t avail      = lsp_min(size_t(nCapacity - uatomic_t(head - tail)), count);
+            if (avail < count)
+                atomic_add(&nDropped, count - avail);
+            if (avail <= 0)
+                return 0;
+
+            // The data may wrap around the end of the ring
+            const size_t off        = head & (nCapacity - 1);
+            const size_t part       = lsp_min(avail, nCapacity - off);
+            for (size_t i=0; i<nLanes; ++i)
+            {
+                float *lane             = &vData[i * nCapacity];
+                if (src[i] != NULL)
+                {
+                    dsp::copy(&lane[off], src[i], part);
+                    dsp::copy(lane, &src[i][part], avail - part);
+                }
+                else
+                {
+                    dsp::fill_zero(&lane[off], part);
+                    dsp::fill_zero(lane, avail - part);
+                }
+            }
+
+            // Publish the samples
+            atomic_store(&nHead, head + avail);
+            return avail;
+        }
+
+        size_t SampleRing::read(float * const *dst, size_t count)
+        {
+            if (vData == NULL)
+                return 0;
+
+            const uatomic_t tail    = atomic_load(&nTail);
+            const uatomic_t head    = atomic_load(&nHead);
+            const size_t avail      = lsp_min(size_t(uatomic_t(head - tail)), count);
+            if (avail <= 0)
+                return 0;
+
+            const size_t off        = tail & (nCapacity - 1);
+            const size_t part       = lsp_min(avail, nCapacity - off);
+            for (size_t i=0; i<nLanes; ++i)
+            {
+                const float *lane       = &vData[i * nCapacity];
+                dsp::copy(dst[i], &lane[off], part);
+                dsp::copy(&dst[i][part], lane, avail - part);
+            }
+
+            // Release the samples
+            atomic_store(&nTail, tail + avail);
+            return avail;
+        }
+
+        size_t SampleRing::pending()
+        {
+            const uatomic_t head    = atomic_load(&nHead);
+            const uatomic_t tail    = atomic_load(&nTail);
+            return uatomic_t(head - tail);
+        }
+
+        size_t SampleRing::space()
+        {
+            const uatomic_t head    = atomic_load(&nHead);
+            const uatomic_t tail    = atomic_load(&nTail);
+            return nCapacity - uatomic_t(head - tail);
+        }
+
+        size_t SampleRing::dropped()
+        {
+            return atomic_load(&nDropped);
+        }
+
+        //---------------------------------------------------------------------
+        FrameBuffer::FrameBuffer()
+        {
+            vData       = NULL;
+            nSize       = 0;
+            nBack       = 0;
+            nFront      = 1;
+            nMiddle     = 2;
+        }
+
+        FrameBuffer::~FrameBuffer()
+        {
+            destroy();
+        }
+
+        status_t FrameBuffer::init(size_t size)
+        {
+            destroy();
+
+            vData               = static_cast<float *>(malloc(size * 3 * sizeof(float)));
+            if (vData == NULL)
+                return STATUS_NO_MEM;
+            dsp::fill_zero(vData, size * 3);
+
+            nSize               = size;
+            nBack               = 0;
+            nFront              = 1;
+            atomic_store(&nMiddle, 2);
+
+            return STATUS_OK;
+        }
+
+        void FrameBuffer::destroy()
+        {
+            if (vData != NULL)
+            {
+                free(vData);
+                vData       = NULL;
+            }
+            nSize       = 0;
+        }
+
+        float *FrameBuffer::back()
+        {
+            return (vData != NULL) ? &vData[nBack * nSize] : NULL;
+        }
+
+        void FrameBuffer::publish()
+        {
+            nBack               = atomic_swap(&nMiddle, nBack | FRAME_FRESH) & FRAME_INDEX;
+        }
+
+        const float *FrameBuffer::front()
+        {
+            if (vData == NULL)
+                return NULL;
+
+            if (atomic_load(&nMiddle) & FRAME_FRESH)
+                nFront              = atomic_swap(&nMiddle, nFront) & FRAME_INDEX;
+
+            return &vData[nFront * nSize];
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/bits.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#include <private/util/EventTrace.h>
+
+#include <stdlib.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        static const char *trace_event_names[] =
+        {
+            "sample_rate",
+            "plan_rebuild",
+            "delay_clear",
+            "xover_reset",
+            "oversampler",
+            "latency",
+            "overrun"
+        };
+
+        //---------------------------------------------------------------------
+        EventTrace::EventTrace()
+        {
+            vRecords    = NULL;
+            nCapacity   = 0;
+            nHead       = 0;
+            nTail       = 0;
+            nDropped    = 0;
+            nBlock      = 0;
+            nSample     = 0;
+        }
+
+        EventTrace::~EventTrace()
+        {
+            destroy();
+        }
+
+        status_t EventTrace::init(size_t capacity)
+        {
+            destroy();
+
+            const size_t cap    = size_t(1) << int_log2(lsp_max(capacity, size_t(2)) * 2 - 1);
+            vRecords            = static_cast<trace_record_t *>(malloc(cap * sizeof(trace_record_t)));
+            if (vRecords == NULL)
+                return STATUS_NO_MEM;
+
+            nCapacity           = cap;
+            atomic_store(&nHead, 0);
+            atomic_store(&nTail, 0);
+            atomic_store(&nDropped, 0);
+            nBlock              = 0;
+            nSample             = 0;
+
+            return STATUS_OK;
+        }
+
+        void EventTrace::destroy()
+        {
+            if (vRecords != NULL)
+            {
+                free(vRecords);
+                vRecords    = NULL;
+            }
+            nCapacity   = 0;
+        }
+
+        bool EventTrace::record(trace_event_t type, uint32_t arg)
+        {
+            if (vRecords == NULL)
+                return false;
+
+            const uatomic_t head    = atomic_load(&nHead);
+            const uatomic_t tail    = atomic_load(&nTail);
+            if (uatomic_t(head - tail) >= nCapacity)
+            {
+                atomic_add(&nDropped, 1);
+                return false;
+            }
+
+            trace_record_t *r       = &vRecords[head & (nCapacity - 1)];
+            r->nBlock               = nBlock;
+            r->nSample              = nSample;
+            r->nType                = type;
+            r->nArg                 = arg;
+
+            // Publish the record
+            atomic_store(&nHead, head + 1);
+            return true;
+        }
+
+        size_t EventTrace::read(trace_record_t *dst, size_t count)
+        {
+            if (vRecords == NULL)
+                return 0;
+
+            const uatomic_t tail    = atomic_load(&nTail);
+            const uatomic_t head    = atomic_load(&nHead);
+            const size_t avail      = lsp_min(size_t(uatomic_t(head - tail)), count);
+
+            for (size_t i=0; i<avail; ++i)
+                dst[i]                  = vRecords[(tail + i) & (nCapacity - 1)];
+
+            // Release the slots
+            atomic_store(&nTail, tail + avail);
+            return avail;
+        }
+
+        size_t EventTrace::pending()
+        {
+            const uatomic_t head    = atomic_load(&nHead);
+            const uatomic_t tail    = atomic_load(&nTail);
+            return uatomic_t(head - tail);
+        }
+
+        size_t EventTrace::dropped()
+        {
+            return atomic_load(&nDropped);
+        }
+
+        status_t EventTrace::drain(const char *path)
+        {
+            trace_record_t buf[64];
+
+            FILE *fd = fopen(path, "a");
+            if (fd == NULL)
+                return STATUS_IO_ERROR;
+
+            size_t count;
+            while ((count = read(buf, sizeof(buf)/sizeof(trace_record_t))) > 0)
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    const trace_record_t *r = &buf[i];
+                    fprintf(fd, "block=%llu sample=%llu event=%s arg=%u\n",
+                        (unsigned long long)r->nBlock, (unsigned long long)r->nSample,
+                        event_name(r->nType), (unsigned int)r->nArg);
+                }
+            }
+
+            const size_t lost = atomic_swap(&nDropped, 0);
+            if (lost > 0)
+                fprintf(fd, "dropped=%u\n", (unsigned int)lost);
+
+            fclose(fd);
+            return STATUS_OK;
+        }
+
+        const char *EventTrace::event_name(uint32_t type)
+        {
+            return (type < TE_TOTAL) ? trace_event_names[type] : "unknown";
+        }
+
+        //---------------------------------------------------------------------
+        EventTraceWriter::EventTraceWriter(EventTrace *trace)
+        {
+            pTrace      = trace;
+            sPath       = NULL;
+        }
+
+        EventTraceWriter::~EventTraceWriter()
+        {
+            if (sPath != NULL)
+            {
+                free(sPath);
+                sPath       = NULL;
+            }
+        }
+
+        status_t EventTraceWriter::set_path(const char *path)
+        {
+            char *tmp   = strdup(path);
+            if (tmp == NULL)
+                return STATUS_NO_MEM;
+
+            if (sPath != NULL)
+                free(sPath);
+            sPath       = tmp;
+
+            return STATUS_OK;
+        }
+
+        status_t EventTraceWriter::run()
+        {
+            if ((pTrace == NULL) || (sPath == NULL))
+                return STATUS_BAD_STATE;
+            return pTrace->drain(sPath);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/bits.h>
+
+#include <private/util/ParamQueue.h>
+
+#include <stdlib.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        //---------------------------------------------------------------------
+        ParamPort::ParamPort(plug::IPort *port): plug::IPort(port->metadata())
+        {
+            pPort       = port;
+            fValue      = 0.0f;
+            fHost       = 0.0f;
+            bOverride   = false;
+        }
+
+        ParamPort::~ParamPort()
+        {
+            pPort       = NULL;
+        }
+
+        float ParamPort::value()
+        {
+            return (bOverride) ? fValue : pPort->value();
+        }
+
+        void ParamPort::set_value(float value)
+        {
+            fValue      = value;
+            fHost       = pPort->value();
+            bOverride   = true;
+        }
+
+        void *ParamPort::buffer()
+        {
+            return pPort->buffer();
+        }
+
+        void ParamPort::sync()
+        {
+            if ((bOverride) && (pPort->value() != fHost))
+                bOverride   = false;
+        }
+
+        //---------------------------------------------------------------------
+        ParamQueue::ParamQueue()
+        {
+            vCells      = NULL;
+            nCapacity   = 0;
+            nHead       = 0;
+            nTail       = 0;
+            nDropped    = 0;
+        }
+
+        ParamQueue::~ParamQueue()
+        {
+            destroy();
+        }
+
+        status_t ParamQueue::init(size_t capacity)
+        {
+            destroy();
+
+            const size_t cap    = size_t(1) << int_log2(lsp_max(capacity, size_t(2)) * 2 - 1);
+            vCells              = static_cast<cell_t *>(malloc(cap * sizeof(cell_t)));
+            if (vCells == NULL)
+                return STATUS_NO_MEM;
+
+            // The cell is free for the producer when its sequence number matches the write position
+            for (size_t i=0; i<cap; ++i)
+                atomic_store(&vCells[i].nSeq, i);
+
+            nCapacity           = cap;
+            atomic_store(&nHead, 0);
+            atomic_store(&nTail, 0);
+            atomic_store(&nDropped, 0);
+
+            return STATUS_OK;
+        }
+
+        void ParamQueue::destroy()
+        {
+            if (vCells != NULL)
+            {
+                free(vCells);
+                vCells      = NULL;
+            }
+            nCapacity   = 0;
+        }
+
+        bool ParamQueue::post(ParamPort *port, float value, uint64_t frame)
+        {
+            if (vCells == NULL)
+                return false;
+
+            // Reserve the cell, other producers may take the same position first
+            uatomic_t pos           = atomic_load(&nTail);
+            cell_t *cell;
+            while (true)
+            {
+                cell                    = &vCells[pos & (nCapacity - 1)];
+                const uatomic_t seq     = atomic_load(&cell->nSeq);
+                const int32_t diff      = int32_t(seq - pos);
+                if (diff == 0)
+                {
+                    if (atomic_cas(&nTail, pos, pos + 1))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    // The consumer did not release the cell yet, the queue is full
+                    atomic_add(&nDropped, 1);
+                    return false;
+                }
+                pos                     = atomic_load(&nTail);
+            }
+
+            cell->sEvent.nFrame     = frame;
+            cell->sEvent.pPort      = port;
+            cell->sEvent.fValue     = value;
+
+            // Publish the event
+            atomic_store(&cell->nSeq, pos + 1);
+            return true;
+        }
+
+        const param_event_t *ParamQueue::front()
+        {
+            if (vCells == NULL)
+                return NULL;
+
+            const uatomic_t pos     = atomic_load(&nHead);
+            cell_t *cell            = &vCells[pos & (nCapacity - 1)];
+            return (atomic_load(&cell->nSeq) == uatomic_t(pos + 1)) ? &cell->sEvent : NULL;
+        }
+
+        void ParamQueue::pop()
+        {
+            if (vCells == NULL)
+                return;
+
+            // Release the cell for the producer that writes the next lap of the ring
+            const uatomic_t pos     = atomic_load(&nHead);
+            cell_t *cell            = &vCells[pos & (nCapacity - 1)];
+            atomic_store(&cell->nSeq, pos + nCapacity);
+            atomic_store(&nHead, pos + 1);
+        }
+
+        size_t ParamQueue::dropped()
+        {
+            return atomic_load(&nDropped);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
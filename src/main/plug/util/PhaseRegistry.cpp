@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/bits.h>
+
+#include <private/util/PhaseRegistry.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        static constexpr size_t SLOT_BITS       = 32;
+        static constexpr size_t SLOT_WORDS      = PhaseRegistry::SLOTS_MAX / SLOT_BITS;
+
+        /* Bitmap of acquired slots */
+        static uatomic_t slots[SLOT_WORDS];
+
+        //---------------------------------------------------------------------
+        ssize_t PhaseRegistry::acquire()
+        {
+            for (size_t i=0; i<SLOT_WORDS; ++i)
+            {
+                while (true)
+                {
+                    const uint32_t word     = atomic_load(&slots[i]);
+                    if (word == 0xffffffffu)
+                        break;
+
+                    // Take the lowest free bit of the word
+                    const uint32_t bit      = ~word & (word + 1);
+                    if (atomic_cas(&slots[i], word, word | bit))
+                        return i * SLOT_BITS + int_log2(bit);
+                }
+            }
+
+            return -1;
+        }
+
+        void PhaseRegistry::release(ssize_t slot)
+        {
+            if ((slot < 0) || (size_t(slot) >= SLOTS_MAX))
+                return;
+
+            uatomic_t *word         = &slots[slot / SLOT_BITS];
+            const uint32_t bit      = uint32_t(1) << (slot % SLOT_BITS);
+            while (true)
+            {
+                const uint32_t value    = atomic_load(word);
+                if (atomic_cas(word, value, value & (~bit)))
+                    break;
+            }
+        }
+
+        float PhaseRegistry::phase(ssize_t slot)
+        {
+            if (slot < 0)
+                return 0.0f;
+
+            // Van der Corput sequence: reverse bits of the slot index
+            uint32_t value          = slot;
+            uint32_t rev            = 0;
+            for (size_t i=1; i<SLOTS_MAX; i <<= 1)
+            {
+                rev                     = (rev << 1) | (value & 1);
+                value                 >>= 1;
+            }
+
+            return float(rev) / float(SLOTS_MAX);
+        }
+
+        size_t PhaseRegistry::acquired()
+        {
+            size_t count            = 0;
+            for (size_t i=0; i<SLOT_WORDS; ++i)
+            {
+                uint32_t word           = atomic_load(&slots[i]);
+                for ( ; word != 0; word &= word - 1)
+                    ++count;
+            }
+
+            return count;
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/util/Semaphore.h>
+
+#ifdef PLATFORM_LINUX
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif /* PLATFORM_LINUX */
+
+namespace lsp
+{
+    namespace plugins
+    {
+    #if defined(PLATFORM_WINDOWS)
+        Semaphore::Semaphore()
+        {
+            hSem        = CreateSemaphoreW(NULL, 0, LONG_MAX, NULL);
+        }
+
+        Semaphore::~Semaphore()
+        {
+            if (hSem != NULL)
+            {
+                CloseHandle(hSem);
+                hSem        = NULL;
+            }
+        }
+
+        void Semaphore::post()
+        {
+            ReleaseSemaphore(hSem, 1, NULL);
+        }
+
+        void Semaphore::wait()
+        {
+            WaitForSingleObject(hSem, INFINITE);
+        }
+
+        bool Semaphore::try_wait()
+        {
+            return WaitForSingleObject(hSem, 0) == WAIT_OBJECT_0;
+        }
+
+    #elif defined(PLATFORM_LINUX)
+        Semaphore::Semaphore()
+        {
+            atomic_store(&nCount, 0);
+            atomic_store(&nWaiters, 0);
+        }
+
+        Semaphore::~Semaphore()
+        {
+        }
+
+        void Semaphore::post()
+        {
+            atomic_add(&nCount, 1);
+            // The waiter registers itself before it checks the counter in the kernel,
+            // so it either sees the token or is counted here
+            if (atomic_load(&nWaiters) > 0)
+                syscall(SYS_futex, &nCount, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        }
+
+        bool Semaphore::try_wait()
+        {
+            while (true)
+            {
+                const uatomic_t count = atomic_load(&nCount);
+                if (count == 0)
+                    return false;
+                if (atomic_cas(&nCount, count, count - 1))
+                    return true;
+            }
+        }
+
+        void Semaphore::wait()
+        {
+            while (!try_wait())
+            {
+                atomic_add(&nWaiters, 1);
+                syscall(SYS_futex, &nCount, FUTEX_WAIT_PRIVATE, 0, NULL, NULL, 0);
+                atomic_add(&nWaiters, -1);
+            }
+        }
+
+    #else
+        Semaphore::Semaphore()
+        {
+            pthread_mutex_init(&sMutex, NULL);
+            pthread_cond_init(&sCond, NULL);
+            nCount      = 0;
+        }
+
+        Semaphore::~Semaphore()
+        {
+            pthread_cond_destroy(&sCond);
+            pthread_mutex_destroy(&sMutex);
+        }
+
+        void Semaphore::post()
+        {
+            pthread_mutex_lock(&sMutex);
+            ++nCount;
+            pthread_cond_signal(&sCond);
+            pthread_mutex_unlock(&sMutex);
+        }
+
+        void Semaphore::wait()
+        {
+            pthread_mutex_lock(&sMutex);
+            while (nCount <= 0)
+                pthread_cond_wait(&sCond, &sMutex);
+            --nCount;
+            pthread_mutex_unlock(&sMutex);
+        }
+
+        bool Semaphore::try_wait()
+        {
+            pthread_mutex_lock(&sMutex);
+            const bool taken = nCount > 0;
+            if (taken)
+                --nCount;
+            pthread_mutex_unlock(&sMutex);
+            return taken;
+        }
+
+    #endif /* PLATFORM_WINDOWS */
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/bits.h>
+#include <lsp-plug.in/ipc/Mutex.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+#include <private/util/Semaphore.h>
+#include <private/util/TaskPool.h>
+#include <private/util/ThreadPriority.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /* Number of polls of the submitter before it goes to sleep */
+        static constexpr size_t SPIN_LIMIT      = 0x400;
+
+        /*
+         * Layout of the batch cursor. The generation counter is incremented for each batch
+         * and prevents threads that have been preempted in the middle of the previous batch
+         * from taking a task of the next one with a stale cursor value.
+         */
+        static constexpr uint32_t CURSOR_INDEX_MASK = 0xff;
+        static constexpr uint32_t CURSOR_COUNT_SHIFT= 8;
+        static constexpr uint32_t CURSOR_COUNT_MASK = 0xff;
+        static constexpr uint32_t CURSOR_GEN_SHIFT  = 16;
+        static constexpr uint32_t CURSOR_GEN_MASK   = 0xffff;
+
+        static constexpr size_t SLOT_BITS       = 32;
+        static constexpr size_t SLOT_WORDS      = TaskPool::SLOTS_MAX / SLOT_BITS;
+
+        /*
+         * Slot of the client. Slots are never freed, so pool threads may access any slot at
+         * any time. The task and the object are read only after the task has been taken with
+         * the cursor of the actual batch, the cursor keeps the generation when the slot passes
+         * to another client.
+         */
+        typedef struct slot_t
+        {
+            TaskPool::task_t        pTask;          // Task function
+            void                   *pObject;        // Object passed to the task
+            uatomic_t               nCursor;        // Batch cursor: generation, number of tasks and next task index
+            uatomic_t               nDone;          // Number of completed tasks of the current batch
+            Semaphore               sDone;          // Wakes up the submitter
+            ThreadPriority          sPriority;      // Priority of the submitter
+        } slot_t;
+
+        /* Shared state of the pool */
+        static slot_t       slots[TaskPool::SLOTS_MAX];
+        static uatomic_t    acquired[SLOT_WORDS];   // Bitmap of acquired slots
+        static Semaphore    wakeup;                 // Wakes up pool threads
+        static uatomic_t    stop_request;           // Shutdown request
+        static ipc::Mutex   pool_lock;              // Protects the list of threads and clients
+        static ipc::Thread *workers[TaskPool::THREADS_MAX];  // Pool threads
+        static size_t       nthreads    = 0;        // Number of pool threads
+        static uatomic_t    nwakeups    = 0;        // Number of pool threads to wake up for the batch
+        static size_t       nclients    = 0;        // Number of connected clients
+
+        static ssize_t acquire_slot()
+        {
+            for (size_t i=0; i<SLOT_WORDS; ++i)
+            {
+                while (true)
+                {
+                    const uint32_t word     = atomic_load(&acquired[i]);
+                    if (word == 0xffffffffu)
+                        break;
+
+                    // Take the lowest free bit of the word
+                    const uint32_t bit      = ~word & (word + 1);
+                    if (atomic_cas(&acquired[i], word, word | bit))
+                        return i * SLOT_BITS + int_log2(bit);
+                }
+            }
+
+            return -1;
+        }
+
+        static void release_slot(size_t slot)
+        {
+            uatomic_t *word         = &acquired[slot / SLOT_BITS];
+            const uint32_t bit      = uint32_t(1) << (slot % SLOT_BITS);
+            while (true)
+            {
+                const uint32_t value    = atomic_load(word);
+                if (atomic_cas(word, value, value & (~bit)))
+                    break;
+            }
+        }
+
+        /**
+         * Execute the next task of the batch
+         * @param s slot of the client
+         * @param priority priority applied to the calling pool thread, NULL for the submitter
+         * @param last set to true if the call completed the last task of the batch
+         * @return false if there are no more tasks to take
+         */
+        static bool execute_next(slot_t *s, uatomic_t *priority, bool *last)
+        {
+            const uint32_t cursor   = atomic_load(&s->nCursor);
+            const uint32_t index    = cursor & CURSOR_INDEX_MASK;
+            const uint32_t count    = (cursor >> CURSOR_COUNT_SHIFT) & CURSOR_COUNT_MASK;
+            if (index >= count)
+                return false;
+
+            // Another thread could take the task first, the caller will retry then
+            if (!atomic_cas(&s->nCursor, cursor, cursor + 1))
+                return true;
+
+            if (priority != NULL)
+                s->sPriority.apply(priority);
+            s->pTask(s->pObject, index);
+            *last                   = (atomic_add(&s->nDone, 1) + 1) == count;
+
+            return true;
+        }
+
+        static status_t thread_proc(void *arg)
+        {
+            uatomic_t priority  = ThreadPriority::NONE;
+            bool last           = false;
+
+            while (true)
+            {
+                wakeup.wait();
+                if (atomic_load(&stop_request) != 0)
+                    break;
+
+                // Execute tasks of all published batches
+                for (bool busy = true; busy; )
+                {
+                    busy                = false;
+                    for (size_t i=0; i<TaskPool::SLOTS_MAX; ++i)
+                    {
+                        slot_t *s           = &slots[i];
+                        while (execute_next(s, &priority, &last))
+                        {
+                            busy                = true;
+                            if (last)
+                            {
+                                s->sDone.post();
+                                last                = false;
+                            }
+                        }
+                    }
+                }
+            }
+
+            return STATUS_OK;
+        }
+
+        static void stop_threads()
+        {
+            atomic_store(&stop_request, 1);
+            for (size_t i=0; i<nthreads; ++i)
+                wakeup.post();
+            for (size_t i=0; i<nthreads; ++i)
+            {
+                workers[i]->join();
+                delete workers[i];
+                workers[i]      = NULL;
+            }
+            nthreads    = 0;
+            atomic_store(&nwakeups, 0);
+
+            // Drop tokens left by submitters
+            while (wakeup.try_wait())
+                /* nothing */;
+            atomic_store(&stop_request, 0);
+        }
+
+        static status_t start_threads(size_t count)
+        {
+            count       = lsp_min(count, TaskPool::THREADS_MAX);
+            while (nthreads < count)
+            {
+                ipc::Thread *thread = new ipc::Thread(thread_proc, NULL);
+                if (thread == NULL)
+                    return STATUS_NO_MEM;
+
+                status_t res = thread->start();
+                if (res != STATUS_OK)
+                {
+                    delete thread;
+                    return res;
+                }
+
+                workers[nthreads++] = thread;
+                atomic_store(&nwakeups, nthreads);
+            }
+
+            return STATUS_OK;
+        }
+
+        //---------------------------------------------------------------------
+        TaskPool::TaskPool()
+        {
+            pTask       = NULL;
+            pObject     = NULL;
+            nSlot       = -1;
+        }
+
+        TaskPool::~TaskPool()
+        {
+            stop();
+        }
+
+        status_t TaskPool::start(size_t threads, task_t task, void *object)
+        {
+            stop();
+
+            pTask               = task;
+            pObject             = object;
+
+            const ssize_t slot  = acquire_slot();
+            if (slot < 0)
+                return STATUS_OVERFLOW;
+
+            slot_t *s           = &slots[slot];
+            s->pTask            = task;
+            s->pObject          = object;
+            atomic_store(&s->nDone, 0);
+
+            pool_lock.lock();
+            status_t res        = start_threads(threads);
+            if ((res != STATUS_OK) && (nthreads <= 0))
+            {
+                pool_lock.unlock();
+                release_slot(slot);
+                return res;
+            }
+            ++nclients;
+            pool_lock.unlock();
+
+            nSlot               = slot;
+            return STATUS_OK;
+        }
+
+        void TaskPool::stop()
+        {
+            if (nSlot < 0)
+                return;
+
+            pool_lock.lock();
+            if ((--nclients) <= 0)
+                stop_threads();
+            pool_lock.unlock();
+
+            release_slot(nSlot);
+            nSlot       = -1;
+        }
+
+        size_t TaskPool::threads()
+        {
+            pool_lock.lock();
+            const size_t count  = nthreads;
+            pool_lock.unlock();
+            return count;
+        }
+
+        void TaskPool::execute(size_t count)
+        {
+            count       = lsp_min(count, TASKS_MAX);
+            if (count <= 0)
+                return;
+
+            // Execute all tasks in the caller's thread if there are no pool threads
+            if (nSlot < 0)
+            {
+                for (size_t i=0; i<count; ++i)
+                    pTask(pObject, i);
+                return;
+            }
+
+            // Publish the batch and wake up pool threads, the submitter takes one of the tasks
+            slot_t *s               = &slots[nSlot];
+            s->sPriority.capture();
+            const uint32_t gen      = (((atomic_load(&s->nCursor) >> CURSOR_GEN_SHIFT) + 1) & CURSOR_GEN_MASK) << CURSOR_GEN_SHIFT;
+            atomic_store(&s->nDone, 0);
+            atomic_store(&s->nCursor, gen | (uint32_t(count) << CURSOR_COUNT_SHIFT));
+
+            const size_t wakeups    = lsp_min(size_t(atomic_load(&nwakeups)), count - 1);
+            for (size_t i=0; i<wakeups; ++i)
+                wakeup.post();
+
+            // Participate in execution. If a pool thread completes the last task, it
+            // wakes up the submitter, the batch is completed otherwise
+            bool done = false, last = false;
+            while (execute_next(s, NULL, &last))
+                done       |= last;
+            for (size_t i=0; (i < SPIN_LIMIT) && (!done); ++i)
+                done        = s->sDone.try_wait();
+            if (!done)
+                s->sDone.wait();
+
+            // Close the batch
+            atomic_store(&s->nCursor, gen);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
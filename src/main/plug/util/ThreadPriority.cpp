@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/util/ThreadPriority.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        static inline uatomic_t pack_params(int policy, int priority)
+        {
+            return (uatomic_t(policy & 0xffff) << 16) | uatomic_t(priority & 0xffff);
+        }
+
+        static inline int unpack_policy(uatomic_t params)
+        {
+            return int16_t(params >> 16);
+        }
+
+        static inline int unpack_priority(uatomic_t params)
+        {
+            return int16_t(params & 0xffff);
+        }
+
+        //---------------------------------------------------------------------
+        ThreadPriority::ThreadPriority()
+        {
+        #ifdef PLATFORM_WINDOWS
+            nOwner      = 0;
+        #endif /* PLATFORM_WINDOWS */
+            bOwner      = false;
+            atomic_store(&nParams, NONE);
+        }
+
+    #ifdef PLATFORM_WINDOWS
+        void ThreadPriority::capture()
+        {
+            const DWORD self    = GetCurrentThreadId();
+            if ((bOwner) && (nOwner == self))
+                return;
+
+            nOwner      = self;
+            bOwner      = true;
+
+            const int priority  = GetThreadPriority(GetCurrentThread());
+            if (priority != THREAD_PRIORITY_ERROR_RETURN)
+                atomic_store(&nParams, pack_params(0, priority));
+        }
+
+        void ThreadPriority::apply(uatomic_t *applied)
+        {
+            const uatomic_t params  = atomic_load(&nParams);
+            if ((params == NONE) || (params == *applied))
+                return;
+
+            SetThreadPriority(GetCurrentThread(), unpack_priority(params));
+            *applied    = params;
+        }
+
+    #else
+        void ThreadPriority::capture()
+        {
+            const pthread_t self    = pthread_self();
+            if ((bOwner) && (pthread_equal(hOwner, self)))
+                return;
+
+            hOwner      = self;
+            bOwner      = true;
+
+            int policy;
+            struct sched_param param;
+            if (pthread_getschedparam(self, &policy, &param) == 0)
+                atomic_store(&nParams, pack_params(policy, param.sched_priority));
+        }
+
+        void ThreadPriority::apply(uatomic_t *applied)
+        {
+            const uatomic_t params  = atomic_load(&nParams);
+            if ((params == NONE) || (params == *applied))
+                return;
+
+            // The call fails if the process is not allowed to use real-time scheduling,
+            // the thread keeps its priority then and is not asked again
+            struct sched_param param;
+            param.sched_priority    = unpack_priority(params);
+            pthread_setschedparam(pthread_self(), unpack_policy(params), &param);
+            *applied    = params;
+        }
+
+    #endif /* PLATFORM_WINDOWS */
+
+    } /* namespace plugins */
+} /* namespace lsp */
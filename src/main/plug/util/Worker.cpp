@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/util/Worker.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /* Number of polls of the joining thread before it goes to sleep */
+        static constexpr size_t SPIN_LIMIT      = 0x400;
+
+        //---------------------------------------------------------------------
+        Worker::Worker()
+        {
+            pThread     = NULL;
+            pJob        = NULL;
+            pObject     = NULL;
+            nArg        = 0;
+            atomic_store(&nState, WS_IDLE);
+            atomic_store(&nShutdown, 0);
+        }
+
+        Worker::~Worker()
+        {
+            stop();
+        }
+
+        status_t Worker::start(job_t job, void *object)
+        {
+            stop();
+
+            pJob        = job;
+            pObject     = object;
+            atomic_store(&nState, WS_IDLE);
+            atomic_store(&nShutdown, 0);
+
+            ipc::Thread *thread = new ipc::Thread(thread_proc, this);
+            if (thread == NULL)
+                return STATUS_NO_MEM;
+
+            status_t res = thread->start();
+            if (res != STATUS_OK)
+            {
+                delete thread;
+                return res;
+            }
+
+            pThread     = thread;
+            return STATUS_OK;
+        }
+
+        void Worker::stop()
+        {
+            if (pThread == NULL)
+                return;
+
+            atomic_store(&nShutdown, 1);
+            sJob.post();
+            pThread->join();
+            delete pThread;
+            pThread     = NULL;
+        }
+
+        status_t Worker::thread_proc(void *arg)
+        {
+            Worker *self = static_cast<Worker *>(arg);
+            return self->run();
+        }
+
+        status_t Worker::run()
+        {
+            uatomic_t priority = ThreadPriority::NONE;
+
+            while (true)
+            {
+                sJob.wait();
+                if (atomic_load(&nShutdown) != 0)
+                    break;
+
+                // The job could be taken back by the submitter
+                sPriority.apply(&priority);
+                if (atomic_cas(&nState, WS_PENDING, WS_RUNNING))
+                {
+                    pJob(pObject, nArg);
+                    atomic_store(&nState, WS_DONE);
+                    sDone.post();
+                }
+            }
+
+            return STATUS_OK;
+        }
+
+        void Worker::submit(size_t arg)
+        {
+            sPriority.capture();
+            nArg        = arg;
+            atomic_store(&nState, WS_PENDING);
+            sJob.post();
+        }
+
+        void Worker::join()
+        {
+            // Take the job back if the worker did not start it
+            if (atomic_cas(&nState, WS_PENDING, WS_IDLE))
+            {
+                pJob(pObject, nArg);
+                return;
+            }
+
+            // The worker executes the job, it usually completes soon
+            bool done = false;
+            for (size_t i=0; (i < SPIN_LIMIT) && (!done); ++i)
+                done        = sDone.try_wait();
+            if (!done)
+                sDone.wait();
+
+            atomic_store(&nState, WS_IDLE);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -0,0 +1,352 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#include <stdlib.h>
+
+#include <private/plugins/mb_limiter.h>
+#include <private/test/PluginHost.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        //---------------------------------------------------------------------
+        HostPort::HostPort(const meta::port_t *meta): plug::IPort(meta)
+        {
+            fValue      = meta->start;
+            pBuffer     = NULL;
+        }
+
+        HostPort::~HostPort()
+        {
+            if (pBuffer != NULL)
+            {
+                free(pBuffer);
+                pBuffer     = NULL;
+            }
+        }
+
+        bool HostPort::init(size_t buffer_size)
+        {
+            // Only audio input and output ports have buffers, all other buffer-based
+            // ports (meshes, shared memory links) are reported as missing
+            if ((pMetadata->role != meta::R_AUDIO_IN) && (pMetadata->role != meta::R_AUDIO_OUT))
+                return true;
+
+            pBuffer     = static_cast<float *>(malloc(buffer_size * sizeof(float)));
+            if (pBuffer == NULL)
+                return false;
+
+            dsp::fill_zero(pBuffer, buffer_size);
+            return true;
+        }
+
+        float HostPort::value()
+        {
+            return fValue;
+        }
+
+        void HostPort::set_value(float value)
+        {
+            fValue      = value;
+        }
+
+        void *HostPort::buffer()
+        {
+            return pBuffer;
+        }
+
+        //---------------------------------------------------------------------
+        PluginHost::PluginHost()
+        {
+            pMeta       = NULL;
+            pModule     = NULL;
+            nSampleRate = 0;
+            nMaxBlock   = 0;
+            bUpdate     = false;
+        }
+
+        PluginHost::~PluginHost()
+        {
+            destroy();
+        }
+
+        status_t PluginHost::init(const meta::plugin_t *meta, size_t sample_rate, size_t max_block, size_t streams)
+        {
+            status_t res    = create(meta, max_block, streams);
+            if (res != STATUS_OK)
+                return res;
+
+            start(sample_rate);
+            return STATUS_OK;
+        }
+
+        status_t PluginHost::create(const meta::plugin_t *meta, size_t max_block, size_t streams)
+        {
+            destroy();
+
+            // Create ports in the same order as they are declared in metadata
+            for (const meta::port_t *p = meta->ports; (p != NULL) && (p->id != NULL); ++p)
+            {
+                HostPort *port  = new HostPort(p);
+                if (port == NULL)
+                    return STATUS_NO_MEM;
+                if (!vPorts.add(port))
+                {
+                    delete port;
+                    return STATUS_NO_MEM;
+                }
+                if (!port->init(max_block))
+                    return STATUS_NO_MEM;
+            }
+
+            // Create the plugin module
+            pModule     = new plugins::mb_limiter(meta, streams);
+            if (pModule == NULL)
+                return STATUS_NO_MEM;
+
+            pMeta       = meta;
+            nMaxBlock   = max_block;
+
+            pModule->init(NULL, reinterpret_cast<plug::IPort **>(vPorts.array()));
+
+            return STATUS_OK;
+        }
+
+        void PluginHost::start(size_t sample_rate)
+        {
+            if (pModule == NULL)
+                return;
+
+            nSampleRate = sample_rate;
+            pModule->set_sample_rate(sample_rate);
+            pModule->activate();
+            bUpdate     = true;
+        }
+
+        void PluginHost::destroy()
+        {
+            if (pModule != NULL)
+            {
+                pModule->deactivate();
+                pModule->destroy();
+                delete pModule;
+                pModule     = NULL;
+            }
+
+            for (size_t i=0, n=vPorts.size(); i<n; ++i)
+            {
+                HostPort *port  = vPorts.uget(i);
+                if (port != NULL)
+                    delete port;
+            }
+            vPorts.flush();
+
+            pMeta       = NULL;
+        }
+
+        HostPort *PluginHost::find_port(const char *id)
+        {
+            for (size_t i=0, n=vPorts.size(); i<n; ++i)
+            {
+                HostPort *port  = vPorts.uget(i);
+                if (!strcmp(port->metadata()->id, id))
+                    return port;
+            }
+
+            return NULL;
+        }
+
+        bool PluginHost::has_port(const char *id)
+        {
+            return find_port(id) != NULL;
+        }
+
+        bool PluginHost::set(const char *id, float value)
+        {
+            HostPort *port  = find_port(id);
+            if (port == NULL)
+                return false;
+
+            if (port->value() != value)
+            {
+                port->set_value(value);
+                bUpdate         = true;
+            }
+
+            return true;
+        }
+
+        size_t PluginHost::set_all(const char *prefix, float value)
+        {
+            const size_t len    = strlen(prefix);
+            size_t affected     = 0;
+
+            for (size_t i=0, n=vPorts.size(); i<n; ++i)
+            {
+                HostPort *port  = vPorts.uget(i);
+                const meta::port_t *p = port->metadata();
+                if ((!meta::is_control_port(p)) || (strncmp(p->id, prefix, len) != 0))
+                    continue;
+
+                if (port->value() != value)
+                {
+                    port->set_value(value);
+                    bUpdate         = true;
+                }
+                ++affected;
+            }
+
+            return affected;
+        }
+
+        float PluginHost::get(const char *id)
+        {
+            HostPort *port  = find_port(id);
+            return (port != NULL) ? port->value() : 0.0f;
+        }
+
+        float *PluginHost::buffer(const char *id)
+        {
+            HostPort *port  = find_port(id);
+            return (port != NULL) ? port->buffer<float>() : NULL;
+        }
+
+        size_t PluginHost::fill_inputs(const float *src, size_t count)
+        {
+            size_t filled       = 0;
+            count               = lsp_min(count, nMaxBlock);
+
+            for (size_t i=0, n=vPorts.size(); i<n; ++i)
+            {
+                HostPort *port  = vPorts.uget(i);
+                if (port->metadata()->role != meta::R_AUDIO_IN)
+                    continue;
+
+                dsp::copy(port->buffer<float>(), src, count);
+                ++filled;
+            }
+
+            return filled;
+        }
+
+        void PluginHost::reset_ports()
+        {
+            for (size_t i=0, n=vPorts.size(); i<n; ++i)
+            {
+                HostPort *port  = vPorts.uget(i);
+                const meta::port_t *p = port->metadata();
+                if (meta::is_in_port(p))
+                    port->set_value(p->start);
+            }
+            bUpdate     = true;
+        }
+
+        void PluginHost::set_sample_rate(size_t sample_rate)
+        {
+            if (pModule == NULL)
+                return;
+
+            nSampleRate     = sample_rate;
+            pModule->set_sample_rate(sample_rate);
+            bUpdate         = true;
+        }
+
+        void PluginHost::update_settings()
+        {
+            if (pModule == NULL)
+                return;
+
+            pModule->update_settings();
+            bUpdate         = false;
+        }
+
+        bool PluginHost::update_resources()
+        {
+            if (pModule == NULL)
+                return false;
+
+            return static_cast<plugins::mb_limiter *>(pModule)->update_resources();
+        }
+
+        void PluginHost::process(size_t samples)
+        {
+            if (pModule == NULL)
+                return;
+
+            if (bUpdate)
+                update_settings();
+            update_resources();
+            pModule->process(lsp_min(samples, nMaxBlock));
+        }
+
+        bool PluginHost::post(const char *id, float value, size_t offset)
+        {
+            HostPort *port  = find_port(id);
+            if ((port == NULL) || (pModule == NULL))
+                return false;
+
+            plugins::mb_limiter *plugin = static_cast<plugins::mb_limiter *>(pModule);
+            return plugin->post_param(port, value, plugin->frame() + offset);
+        }
+
+        void PluginHost::process_bank(const float * const *in, float * const *out, size_t samples)
+        {
+            if (pModule == NULL)
+                return;
+
+            if (bUpdate)
+                update_settings();
+            update_resources();
+            static_cast<plugins::mb_limiter *>(pModule)->process_bank(in, out, lsp_min(samples, nMaxBlock));
+        }
+
+        size_t PluginHost::streams() const
+        {
+            return (pModule != NULL) ? static_cast<const plugins::mb_limiter *>(pModule)->streams() : 0;
+        }
+
+        void PluginHost::set_tile_size(size_t size)
+        {
+            if (pModule == NULL)
+                return;
+
+            static_cast<plugins::mb_limiter *>(pModule)->set_tile_size(size);
+            bUpdate     = true;
+        }
+
+        size_t PluginHost::tile_size() const
+        {
+            return (pModule != NULL) ? static_cast<const plugins::mb_limiter *>(pModule)->tile_size() : 0;
+        }
+
+        ssize_t PluginHost::latency() const
+        {
+            return (pModule != NULL) ? pModule->latency() : 0;
+        }
+
+    } /* namespace test */
+} /* namespace lsp */
@@ -0,0 +1,612 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/ipc/Mutex.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/mm/InAudioFileStream.h>
+#include <lsp-plug.in/mm/OutAudioFileStream.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#include <ctype.h>
+#include <stdlib.h>
+
+#include <private/test/batch.h>
+#include <private/test/bench.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /* Number of plugin instances cached by each worker */
+        static constexpr size_t INSTANCE_CACHE  = 2;
+
+        typedef struct cached_host_t
+        {
+            PluginHost             *pHost;          // Plugin instance
+            const meta::plugin_t   *pMeta;          // Plugin metadata
+            size_t                  nSampleRate;    // Sample rate of the instance
+            size_t                  nSettle;        // Time to settle the state for current settings
+            size_t                  nUsed;          // Last use tick
+            float                  *vIn[2];         // Input buffers
+            float                  *vOut[2];        // Output buffers
+        } cached_host_t;
+
+        typedef struct batch_worker_t
+        {
+            ipc::Mutex              sLock;          // Lock of the job queue
+            batch_job_t           **vJobs;          // Job queue
+            size_t                  nHead;          // Head of the queue, taken by the owner
+            size_t                  nTail;          // Tail of the queue, stolen by other workers
+
+            ipc::Thread            *pThread;        // Worker thread
+            struct batch_context_t *pCtx;           // Batch context
+            cached_host_t           vCache[INSTANCE_CACHE]; // Cached plugin instances
+            size_t                  nTick;          // Use counter for the cache
+            float                  *vFrames;        // Interleaved buffer for streaming
+            float                  *vZero;          // Buffer of zeros
+
+            size_t                  nInstances;     // Number of instances created
+            size_t                  nReused;        // Number of jobs rendered by reused instances
+            size_t                  nStolen;        // Number of stolen jobs
+        } batch_worker_t;
+
+        typedef struct batch_context_t
+        {
+            batch_worker_t         *vWorkers;       // List of workers
+            size_t                  nWorkers;       // Number of workers
+            size_t                  nBlockSize;     // Block size
+        } batch_context_t;
+
+        //---------------------------------------------------------------------
+        static char *next_token(char **s)
+        {
+            char *p     = *s;
+            while ((*p != '\0') && (isspace(*p)))
+                ++p;
+            if (*p == '\0')
+                return NULL;
+
+            char *token = p;
+            while ((*p != '\0') && (!isspace(*p)))
+                ++p;
+            if (*p != '\0')
+                *(p++)      = '\0';
+            *s          = p;
+
+            return token;
+        }
+
+        static int compare_jobs(const void *a, const void *b)
+        {
+            const batch_job_t *ja = *static_cast<batch_job_t * const *>(a);
+            const batch_job_t *jb = *static_cast<batch_job_t * const *>(b);
+
+            if (ja->channels != jb->channels)
+                return (ja->channels < jb->channels) ? -1 : 1;
+            if (ja->sample_rate != jb->sample_rate)
+                return (ja->sample_rate < jb->sample_rate) ? -1 : 1;
+            return 0;
+        }
+
+        static status_t probe_job(batch_job_t *job)
+        {
+            mm::InAudioFileStream is;
+            status_t res = is.open(job->src);
+            if (res != STATUS_OK)
+                return res;
+            lsp_finally { is.close(); };
+
+            mm::audio_stream_t fmt;
+            if ((res = is.info(&fmt)) != STATUS_OK)
+                return res;
+
+            job->sample_rate    = fmt.srate;
+            job->channels       = fmt.channels;
+
+            return (select_plugin(job->channels) != NULL) ? STATUS_OK : STATUS_UNSUPPORTED_FORMAT;
+        }
+
+        //---------------------------------------------------------------------
+        static batch_job_t *take_job(batch_context_t *ctx, batch_worker_t *w, bool *stolen)
+        {
+            batch_job_t *job    = NULL;
+
+            // Take the job from the own queue first
+            w->sLock.lock();
+            if (w->nHead < w->nTail)
+                job                 = w->vJobs[w->nHead++];
+            w->sLock.unlock();
+            if (job != NULL)
+            {
+                *stolen             = false;
+                return job;
+            }
+
+            // Steal the job from the tail of the longest queue
+            while (true)
+            {
+                batch_worker_t *victim  = NULL;
+                size_t length           = 0;
+                for (size_t i=0; i<ctx->nWorkers; ++i)
+                {
+                    batch_worker_t *v   = &ctx->vWorkers[i];
+                    v->sLock.lock();
+                    const size_t n      = v->nTail - v->nHead;
+                    v->sLock.unlock();
+                    if (n > length)
+                    {
+                        victim              = v;
+                        length              = n;
+                    }
+                }
+                if (victim == NULL)
+                    return NULL;
+
+                // The queue could be drained by other workers in the meantime
+                victim->sLock.lock();
+                if (victim->nHead < victim->nTail)
+                    job                 = victim->vJobs[--victim->nTail];
+                victim->sLock.unlock();
+                if (job != NULL)
+                {
+                    *stolen             = true;
+                    return job;
+                }
+            }
+        }
+
+        static void bind_buffers(cached_host_t *h)
+        {
+            static const char *in_ports[]   = { "in", "in_l", "in_r", NULL };
+            static const char *out_ports[]  = { "out", "out_l", "out_r", NULL };
+
+            for (size_t i=0, j=0; in_ports[i] != NULL; ++i)
+                if ((h->vIn[j] = h->pHost->buffer(in_ports[i])) != NULL)
+                    ++j;
+            for (size_t i=0, j=0; out_ports[i] != NULL; ++i)
+                if ((h->vOut[j] = h->pHost->buffer(out_ports[i])) != NULL)
+                    ++j;
+        }
+
+        static void drain(batch_worker_t *w, cached_host_t *h, size_t samples)
+        {
+            const size_t block_size = w->pCtx->nBlockSize;
+            for (size_t offset=0; offset < samples; )
+            {
+                const size_t to_do  = lsp_min(samples - offset, block_size);
+                h->pHost->fill_inputs(w->vZero, to_do);
+                h->pHost->process(to_do);
+                offset             += to_do;
+            }
+        }
+
+        static void release_host(cached_host_t *h)
+        {
+            if (h->pHost == NULL)
+                return;
+            h->pHost->destroy();
+            delete h->pHost;
+            h->pHost        = NULL;
+            h->pMeta        = NULL;
+        }
+
+        static cached_host_t *acquire_host(batch_worker_t *w, batch_job_t *job, status_t *res)
+        {
+            const meta::plugin_t *meta  = select_plugin(job->channels);
+            size_t applied              = 0;
+
+            // Look up for the instance with the same configuration
+            for (size_t i=0; i<INSTANCE_CACHE; ++i)
+            {
+                cached_host_t *h    = &w->vCache[i];
+                if ((h->pHost == NULL) || (h->pMeta != meta) || (h->nSampleRate != job->sample_rate))
+                    continue;
+
+                // Apply new settings and flush the state left by the previous job
+                h->pHost->reset_ports();
+                if ((job->preset != NULL) && ((*res = apply_preset(h->pHost, job->preset, &applied)) != STATUS_OK))
+                    return NULL;
+                h->pHost->update_settings();
+
+                const size_t settle = settle_time(h->pHost);
+                drain(w, h, lsp_max(h->nSettle, settle));
+
+                h->nSettle          = settle;
+                h->nUsed            = ++w->nTick;
+                job->reused         = true;
+                job->stats.params   = applied;
+                ++w->nReused;
+                return h;
+            }
+
+            // Replace the least recently used instance
+            cached_host_t *h    = &w->vCache[0];
+            for (size_t i=1; i<INSTANCE_CACHE; ++i)
+                if (w->vCache[i].nUsed < h->nUsed)
+                    h                   = &w->vCache[i];
+            release_host(h);
+
+            h->pHost            = new PluginHost();
+            if (h->pHost == NULL)
+            {
+                *res                = STATUS_NO_MEM;
+                return NULL;
+            }
+            if ((*res = h->pHost->init(meta, job->sample_rate, w->pCtx->nBlockSize)) != STATUS_OK)
+            {
+                release_host(h);
+                return NULL;
+            }
+            if ((job->preset != NULL) && ((*res = apply_preset(h->pHost, job->preset, &applied)) != STATUS_OK))
+            {
+                release_host(h);
+                return NULL;
+            }
+            h->pHost->update_settings();
+            bind_buffers(h);
+
+            h->pMeta            = meta;
+            h->nSampleRate      = job->sample_rate;
+            h->nSettle          = settle_time(h->pHost);
+            h->nUsed            = ++w->nTick;
+            job->reused         = false;
+            job->stats.params   = applied;
+            ++w->nInstances;
+
+            return h;
+        }
+
+        static status_t render_job(batch_worker_t *w, batch_job_t *job)
+        {
+            const size_t block_size = w->pCtx->nBlockSize;
+            const size_t channels   = job->channels;
+
+            // Open the input stream
+            mm::InAudioFileStream is;
+            status_t res = is.open(job->src);
+            if (res != STATUS_OK)
+                return res;
+            lsp_finally { is.close(); };
+
+            // Prepare the plugin instance
+            cached_host_t *h        = acquire_host(w, job, &res);
+            if (h == NULL)
+                return res;
+            const size_t latency    = h->pHost->latency();
+
+            // Open the output stream
+            mm::audio_stream_t fmt;
+            if ((res = is.info(&fmt)) != STATUS_OK)
+                return res;
+            fmt.format              = mm::SFMT_F32_CPU;
+
+            mm::OutAudioFileStream os;
+            if ((res = os.open(job->dst, &fmt, mm::AFMT_WAV | mm::CFMT_PCM)) != STATUS_OK)
+                return res;
+            lsp_finally { os.close(); };
+
+            // Stream the data, feed 'latency' zero samples after the end of input
+            // and drop first 'latency' samples of output
+            const double start      = precise_time();
+            size_t skip             = latency;
+            size_t tail             = latency;
+            size_t frames           = 0;
+            bool eof                = false;
+
+            while (true)
+            {
+                size_t to_do            = 0;
+                if (!eof)
+                {
+                    const ssize_t n         = is.read(w->vFrames, block_size);
+                    if (n > 0)
+                        to_do                   = n;
+                    else if ((n == 0) || (n == -STATUS_EOF))
+                        eof                     = true;
+                    else
+                        return status_t(-n);
+                }
+
+                // Deinterleave the input
+                for (size_t ch=0; ch<channels; ++ch)
+                {
+                    float *dst              = h->vIn[ch];
+                    const float *src        = &w->vFrames[ch];
+                    for (size_t i=0; i<to_do; ++i, src += channels)
+                        dst[i]                  = *src;
+                }
+                frames                 += to_do;
+
+                if (eof)
+                {
+                    to_do                   = lsp_min(tail, block_size);
+                    if (to_do <= 0)
+                        break;
+                    tail                   -= to_do;
+                    for (size_t ch=0; ch<channels; ++ch)
+                        dsp::fill_zero(h->vIn[ch], to_do);
+                }
+
+                h->pHost->process(to_do);
+
+                // Interleave and write the output
+                const size_t head       = lsp_min(skip, to_do);
+                const size_t count      = to_do - head;
+                skip                   -= head;
+                if (count <= 0)
+                    continue;
+
+                for (size_t ch=0; ch<channels; ++ch)
+                {
+                    const float *src        = &h->vOut[ch][head];
+                    float *dst              = &w->vFrames[ch];
+                    for (size_t i=0; i<count; ++i, dst += channels)
+                        *dst                    = src[i];
+                }
+
+                const ssize_t n         = os.write(w->vFrames, count);
+                if (n < 0)
+                    return status_t(-n);
+            }
+
+            job->stats.channels     = channels;
+            job->stats.sample_rate  = job->sample_rate;
+            job->stats.frames       = frames;
+            job->stats.latency      = latency;
+            job->stats.seconds      = precise_time() - start;
+
+            return os.close();
+        }
+
+        static status_t batch_worker(void *arg)
+        {
+            batch_worker_t *w   = static_cast<batch_worker_t *>(arg);
+
+            bool stolen         = false;
+            for (batch_job_t *job; (job = take_job(w->pCtx, w, &stolen)) != NULL; )
+            {
+                if (stolen)
+                    ++w->nStolen;
+                job->status         = render_job(w, job);
+            }
+
+            return STATUS_OK;
+        }
+
+        //---------------------------------------------------------------------
+        BatchRenderer::BatchRenderer()
+        {
+        }
+
+        BatchRenderer::~BatchRenderer()
+        {
+            clear();
+        }
+
+        status_t BatchRenderer::add(const char *src, const char *preset, const char *dst)
+        {
+            batch_job_t *job    = static_cast<batch_job_t *>(malloc(sizeof(batch_job_t)));
+            if (job == NULL)
+                return STATUS_NO_MEM;
+            memset(job, 0, sizeof(batch_job_t));
+
+            job->src            = strdup(src);
+            job->preset         = (preset != NULL) ? strdup(preset) : NULL;
+            job->dst            = strdup(dst);
+            job->status         = STATUS_OK;
+
+            if ((job->src == NULL) || (job->dst == NULL) || ((preset != NULL) && (job->preset == NULL)) || (!vJobs.add(job)))
+            {
+                free(job->src);
+                free(job->preset);
+                free(job->dst);
+                free(job);
+                return STATUS_NO_MEM;
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t BatchRenderer::load_manifest(const char *path)
+        {
+            FILE *fd = fopen(path, "r");
+            if (fd == NULL)
+                return STATUS_NOT_FOUND;
+            lsp_finally { fclose(fd); };
+
+            char line[4096];
+            while (fgets(line, sizeof(line), fd) != NULL)
+            {
+                char *s             = line;
+                const char *src     = next_token(&s);
+                if ((src == NULL) || (*src == '#'))
+                    continue;
+
+                const char *preset  = next_token(&s);
+                const char *dst     = next_token(&s);
+                if ((preset == NULL) || (dst == NULL) || (next_token(&s) != NULL))
+                    return STATUS_BAD_FORMAT;
+
+                status_t res        = add(src, (strcmp(preset, "-") != 0) ? preset : NULL, dst);
+                if (res != STATUS_OK)
+                    return res;
+            }
+
+            return STATUS_OK;
+        }
+
+        void BatchRenderer::clear()
+        {
+            for (size_t i=0, n=vJobs.size(); i<n; ++i)
+            {
+                batch_job_t *job    = vJobs.uget(i);
+                free(job->src);
+                free(job->preset);
+                free(job->dst);
+                free(job);
+            }
+            vJobs.flush();
+        }
+
+        status_t BatchRenderer::run(size_t threads, size_t block_size, batch_stats_t *stats)
+        {
+            const double start      = precise_time();
+            block_size              = lsp_max(block_size, size_t(1));
+
+            // Probe the input files and group jobs by the plugin configuration
+            const size_t count      = vJobs.size();
+            batch_job_t **queue     = static_cast<batch_job_t **>(malloc(lsp_max(count, size_t(1)) * sizeof(batch_job_t *)));
+            if (queue == NULL)
+                return STATUS_NO_MEM;
+            lsp_finally { free(queue); };
+
+            size_t queued           = 0;
+            size_t failed           = 0;
+            for (size_t i=0; i<count; ++i)
+            {
+                batch_job_t *job        = vJobs.uget(i);
+                job->reused             = false;
+                memset(&job->stats, 0, sizeof(render_stats_t));
+                if ((job->status = probe_job(job)) == STATUS_OK)
+                    queue[queued++]         = job;
+                else
+                    ++failed;
+            }
+            qsort(queue, queued, sizeof(batch_job_t *), compare_jobs);
+
+            // Distribute contiguous groups of jobs between workers
+            threads                 = lsp_max(lsp_min(threads, queued), size_t(1));
+            batch_context_t ctx;
+            ctx.vWorkers            = new batch_worker_t[threads];
+            if (ctx.vWorkers == NULL)
+                return STATUS_NO_MEM;
+            ctx.nWorkers            = threads;
+            ctx.nBlockSize          = block_size;
+            lsp_finally {
+                for (size_t i=0; i<ctx.nWorkers; ++i)
+                {
+                    batch_worker_t *w   = &ctx.vWorkers[i];
+                    for (size_t j=0; j<INSTANCE_CACHE; ++j)
+                        release_host(&w->vCache[j]);
+                    free(w->vFrames);
+                    free(w->vZero);
+                }
+                delete [] ctx.vWorkers;
+            };
+
+            for (size_t i=0; i<threads; ++i)
+            {
+                batch_worker_t *w   = &ctx.vWorkers[i];
+                w->vFrames          = NULL;
+                w->vZero            = NULL;
+                for (size_t j=0; j<INSTANCE_CACHE; ++j)
+                    w->vCache[j].pHost  = NULL;
+            }
+
+            for (size_t i=0; i<threads; ++i)
+            {
+                batch_worker_t *w   = &ctx.vWorkers[i];
+                w->vJobs            = queue;
+                w->nHead            = (queued * i) / threads;
+                w->nTail            = (queued * (i + 1)) / threads;
+                w->pThread          = NULL;
+                w->pCtx             = &ctx;
+                for (size_t j=0; j<INSTANCE_CACHE; ++j)
+                {
+                    cached_host_t *h    = &w->vCache[j];
+                    h->pHost            = NULL;
+                    h->pMeta            = NULL;
+                    h->nSampleRate      = 0;
+                    h->nSettle          = 0;
+                    h->nUsed            = 0;
+                }
+                w->nTick            = 0;
+                w->vFrames          = static_cast<float *>(malloc(block_size * 2 * sizeof(float)));
+                w->vZero            = static_cast<float *>(malloc(block_size * sizeof(float)));
+                w->nInstances       = 0;
+                w->nReused          = 0;
+                w->nStolen          = 0;
+                if ((w->vFrames == NULL) || (w->vZero == NULL))
+                    return STATUS_NO_MEM;
+                dsp::fill_zero(w->vZero, block_size);
+            }
+
+            // Run workers, the caller's thread serves as the first worker
+            status_t res            = STATUS_OK;
+            for (size_t i=1; i<threads; ++i)
+            {
+                batch_worker_t *w   = &ctx.vWorkers[i];
+                w->pThread          = new ipc::Thread(batch_worker, w);
+                if (w->pThread == NULL)
+                {
+                    res                 = STATUS_NO_MEM;
+                    break;
+                }
+                if ((res = w->pThread->start()) != STATUS_OK)
+                {
+                    delete w->pThread;
+                    w->pThread          = NULL;
+                    break;
+                }
+            }
+
+            // Jobs of workers that failed to start are stolen by running workers
+            batch_worker(&ctx.vWorkers[0]);
+            for (size_t i=1; i<threads; ++i)
+            {
+                batch_worker_t *w   = &ctx.vWorkers[i];
+                if (w->pThread == NULL)
+                    continue;
+                w->pThread->join();
+                delete w->pThread;
+                w->pThread          = NULL;
+            }
+
+            if (stats != NULL)
+            {
+                stats->threads      = threads;
+                stats->jobs         = count;
+                stats->failed       = failed;
+                stats->instances    = 0;
+                stats->reused       = 0;
+                stats->stolen       = 0;
+                for (size_t i=0; i<threads; ++i)
+                {
+                    const batch_worker_t *w = &ctx.vWorkers[i];
+                    stats->instances   += w->nInstances;
+                    stats->reused      += w->nReused;
+                    stats->stolen      += w->nStolen;
+                }
+                for (size_t i=0; i<queued; ++i)
+                    if (queue[i]->status != STATUS_OK)
+                        ++stats->failed;
+                stats->seconds      = precise_time() - start;
+            }
+
+            return res;
+        }
+
+    } /* namespace test */
+} /* namespace lsp */
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/runtime/system.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#include <private/test/bench.h>
+
+#include <stdarg.h>
+#include <stdlib.h>
+
+#ifdef PLATFORM_UNIX_COMPATIBLE
+    #include <sys/resource.h>
+#endif /* PLATFORM_UNIX_COMPATIBLE */
+
+namespace lsp
+{
+    namespace test
+    {
+        double precise_time()
+        {
+            system::time_t ts;
+            system::get_time(&ts);
+            return double(ts.seconds) + double(ts.nanos) * 1e-9;
+        }
+
+        void get_resource_usage(resource_usage_t *ru)
+        {
+            ru->peak_rss        = 0;
+            ru->minor_faults    = 0;
+            ru->major_faults    = 0;
+
+        #ifdef PLATFORM_UNIX_COMPATIBLE
+            struct rusage usage;
+            if (getrusage(RUSAGE_SELF, &usage) != 0)
+                return;
+
+        #ifdef PLATFORM_MACOSX
+            ru->peak_rss        = usage.ru_maxrss / 1024;   // Reported in bytes
+        #else
+            ru->peak_rss        = usage.ru_maxrss;          // Reported in kilobytes
+        #endif /* PLATFORM_MACOSX */
+            ru->minor_faults    = usage.ru_minflt;
+            ru->major_faults    = usage.ru_majflt;
+        #endif /* PLATFORM_UNIX_COMPATIBLE */
+        }
+
+        static int compare_doubles(const void *a, const void *b)
+        {
+            const double x = *static_cast<const double *>(a);
+            const double y = *static_cast<const double *>(b);
+            return (x < y) ? -1 : (x > y) ? 1 : 0;
+        }
+
+        static double percentile(const double *sorted, size_t count, double p)
+        {
+            const size_t idx    = size_t(p * (count - 1) + 0.5);
+            return sorted[lsp_min(idx, count - 1)];
+        }
+
+        void compute_stats(time_stats_t *stats, double *samples, size_t count)
+        {
+            stats->count        = count;
+            if (count <= 0)
+            {
+                stats->mean         = 0.0;
+                stats->p50          = 0.0;
+                stats->p99          = 0.0;
+                stats->p999         = 0.0;
+                stats->max          = 0.0;
+                return;
+            }
+
+            qsort(samples, count, sizeof(double), compare_doubles);
+
+            double sum          = 0.0;
+            for (size_t i=0; i<count; ++i)
+                sum                += samples[i];
+
+            stats->mean         = sum / count;
+            stats->p50          = percentile(samples, count, 0.5);
+            stats->p99          = percentile(samples, count, 0.99);
+            stats->p999         = percentile(samples, count, 0.999);
+            stats->max          = samples[count - 1];
+        }
+
+        ResultWriter::ResultWriter()
+        {
+            pFD         = NULL;
+            sPath       = NULL;
+        }
+
+        ResultWriter::~ResultWriter()
+        {
+            close();
+        }
+
+        status_t ResultWriter::open(const char *path, const char *header)
+        {
+            close();
+
+            pFD         = fopen(path, "w");
+            if (pFD == NULL)
+                return STATUS_IO_ERROR;
+            sPath       = strdup(path);
+
+            fprintf(pFD, "%s\n", header);
+            return STATUS_OK;
+        }
+
+        status_t ResultWriter::write(const char *fmt, ...)
+        {
+            if (pFD == NULL)
+                return STATUS_CLOSED;
+
+            va_list args;
+            va_start(args, fmt);
+            vfprintf(pFD, fmt, args);
+            va_end(args);
+            fputc('\n', pFD);
+            fflush(pFD);
+
+            return STATUS_OK;
+        }
+
+        void ResultWriter::close()
+        {
+            if (pFD != NULL)
+            {
+                fclose(pFD);
+                pFD         = NULL;
+            }
+            if (sPath != NULL)
+            {
+                free(sPath);
+                sPath       = NULL;
+            }
+        }
+
+    } /* namespace test */
+} /* namespace lsp */
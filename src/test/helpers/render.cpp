@@ -0,0 +1,471 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/bench.h>
+#include <private/test/render.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        static char *trim(char *s)
+        {
+            while ((*s != '\0') && (isspace(*s)))
+                ++s;
+            char *end = s + strlen(s);
+            while ((end > s) && (isspace(end[-1])))
+                --end;
+            *end = '\0';
+            return s;
+        }
+
+        static bool parse_value(const char *text, float *value)
+        {
+            if (!strcasecmp(text, "true"))
+            {
+                *value  = 1.0f;
+                return true;
+            }
+            if (!strcasecmp(text, "false"))
+            {
+                *value  = 0.0f;
+                return true;
+            }
+
+            // Numeric value with optional 'db' suffix
+            errno           = 0;
+            char *end       = NULL;
+            const float v   = strtof(text, &end);
+            if ((errno != 0) || (end == text))
+                return false;
+            while (isspace(*end))
+                ++end;
+
+            if (*end == '\0')
+                *value  = v;
+            else if (!strcasecmp(end, "db"))
+                *value  = dspu::db_to_gain(v);      // '-inf db' is parsed as -INFINITY and gives 0
+            else
+                return false;
+
+            return true;
+        }
+
+        status_t apply_preset(PluginHost *host, const char *path, size_t *applied)
+        {
+            FILE *fd = fopen(path, "r");
+            if (fd == NULL)
+                return STATUS_NOT_FOUND;
+            lsp_finally { fclose(fd); };
+
+            char line[1024];
+            size_t count    = 0;
+            while (fgets(line, sizeof(line), fd) != NULL)
+            {
+                char *s     = trim(line);
+                if ((*s == '\0') || (*s == '#'))
+                    continue;
+
+                char *eq    = strchr(s, '=');
+                if (eq == NULL)
+                    return STATUS_CORRUPTED;
+                *eq         = '\0';
+
+                const char *key     = trim(s);
+                const char *text    = trim(eq + 1);
+                float value;
+                if (!parse_value(text, &value))
+                    return STATUS_BAD_FORMAT;
+
+                // Parameters of other plugin variants are silently skipped
+                if (host->set(key, value))
+                    ++count;
+            }
+
+            if (applied != NULL)
+                *applied    = count;
+            return STATUS_OK;
+        }
+
+        const meta::plugin_t *select_plugin(size_t channels)
+        {
+            switch (channels)
+            {
+                case 1: return &meta::mb_limiter_mono;
+                case 2: return &meta::mb_limiter_stereo;
+                default: break;
+            }
+            return NULL;
+        }
+
+        static status_t setup_host(PluginHost *host, dspu::Sample *src, const char *preset,
+            size_t block_size, size_t *applied, float **vin, float **vout)
+        {
+            static const char *in_ports[]   = { "in", "in_l", "in_r", NULL };
+            static const char *out_ports[]  = { "out", "out_l", "out_r", NULL };
+
+            const meta::plugin_t *meta = select_plugin(src->channels());
+            if (meta == NULL)
+                return STATUS_UNSUPPORTED_FORMAT;
+
+            // Instantiate and configure the plugin
+            status_t res = host->init(meta, src->sample_rate(), block_size);
+            if (res != STATUS_OK)
+                return res;
+
+            *applied        = 0;
+            if ((preset != NULL) && ((res = apply_preset(host, preset, applied)) != STATUS_OK))
+                return res;
+            host->update_settings();
+
+            // Bind buffers
+            for (size_t i=0, j=0; in_ports[i] != NULL; ++i)
+                if ((vin[j] = host->buffer(in_ports[i])) != NULL)
+                    ++j;
+            for (size_t i=0, j=0; out_ports[i] != NULL; ++i)
+                if ((vout[j] = host->buffer(out_ports[i])) != NULL)
+                    ++j;
+
+            return STATUS_OK;
+        }
+
+        /*
+         * Feed the plugin with source samples starting at position 'first' and store
+         * the latency-compensated output that corresponds to source positions in range
+         * [start, end). Source samples beyond the end of the source are zeros.
+         */
+        static void render_span(PluginHost *host, float **vin, float **vout,
+            dspu::Sample *src, dspu::Sample *dst,
+            size_t first, size_t start, size_t end, size_t latency, size_t block_size)
+        {
+            const size_t channels   = src->channels();
+            const size_t length     = src->length();
+            const size_t total      = end + latency;
+
+            for (size_t offset=first; offset < total; )
+            {
+                const size_t to_do  = lsp_min(total - offset, block_size);
+
+                for (size_t ch=0; ch<channels; ++ch)
+                {
+                    const size_t avail  = (offset < length) ? lsp_min(length - offset, to_do) : 0;
+                    if (avail > 0)
+                        dsp::copy(vin[ch], src->channel(ch, offset), avail);
+                    dsp::fill_zero(&vin[ch][avail], to_do - avail);
+                }
+
+                host->process(to_do);
+
+                // Store the output which corresponds to the requested source samples
+                const size_t head   = lsp_max(offset, start + latency);
+                if (head < offset + to_do)
+                {
+                    const size_t count  = offset + to_do - head;
+                    for (size_t ch=0; ch<channels; ++ch)
+                        dsp::copy(dst->channel(ch, head - latency), &vout[ch][head - offset], count);
+                }
+
+                offset             += to_do;
+            }
+        }
+
+        size_t settle_time(PluginHost *host)
+        {
+            float release   = 0.0f;
+            for (size_t i=0, n=host->ports(); i<n; ++i)
+            {
+                const meta::port_t *p   = host->port(i)->metadata();
+                if ((p->role != meta::R_CONTROL) || (p->unit != meta::U_MSEC))
+                    continue;
+                if ((!strncmp(p->id, "rt", 2)) || (!strncmp(p->id, "art", 3)))
+                    release         = lsp_max(release, host->port(i)->value());
+            }
+
+            return host->latency() + size_t(release * 10.0f * 0.001f * host->sample_rate());
+        }
+
+        static size_t align_up(size_t value, size_t step)
+        {
+            return ((value + step - 1) / step) * step;
+        }
+
+        status_t render_sample(dspu::Sample *dst, dspu::Sample *src, const char *preset,
+            size_t block_size, render_stats_t *stats)
+        {
+            const size_t channels   = src->channels();
+            const size_t length     = src->length();
+
+            PluginHost host;
+            float *vin[2], *vout[2];
+            size_t applied  = 0;
+            status_t res    = setup_host(&host, src, preset, block_size, &applied, vin, vout);
+            if (res != STATUS_OK)
+                return res;
+
+            // Allocate output, the latency can not change while rendering because settings are fixed
+            const size_t latency    = host.latency();
+            if (!dst->init(channels, length, length))
+                return STATUS_NO_MEM;
+            dst->set_sample_rate(src->sample_rate());
+
+            // Render with the tail of 'latency' zero samples and drop first 'latency' samples of output
+            const double start      = precise_time();
+            render_span(&host, vin, vout, src, dst, 0, 0, length, latency, block_size);
+            const double time       = precise_time() - start;
+
+            if (stats != NULL)
+            {
+                stats->channels     = channels;
+                stats->sample_rate  = src->sample_rate();
+                stats->frames       = length;
+                stats->latency      = latency;
+                stats->params       = applied;
+                stats->seconds      = time;
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t render_file(const char *dst, const char *src, const char *preset,
+            size_t block_size, render_stats_t *stats)
+        {
+            // Load the source file
+            dspu::Sample in, out;
+            status_t res = in.load(src);
+            if (res != STATUS_OK)
+                return res;
+
+            if ((res = render_sample(&out, &in, preset, block_size, stats)) != STATUS_OK)
+                return res;
+
+            // Save the result
+            const ssize_t written   = out.save(dst);
+            if (written < 0)
+                return status_t(-written);
+
+            return STATUS_OK;
+        }
+
+        typedef struct chunk_job_t
+        {
+            dspu::Sample           *pSrc;           // Source sample
+            dspu::Sample           *pDst;           // Destination sample, shared by all jobs
+            const char             *sPreset;        // Preset file
+            size_t                  nBlockSize;     // Block size
+            size_t                  nFirst;         // First source sample passed to the plugin
+            size_t                  nStart;         // First source sample of the chunk
+            size_t                  nEnd;           // End of the chunk
+            size_t                  nLatency;       // Expected latency
+            status_t                nStatus;        // Result of rendering
+        } chunk_job_t;
+
+        static status_t chunk_worker(void *arg)
+        {
+            chunk_job_t *job    = static_cast<chunk_job_t *>(arg);
+
+            PluginHost host;
+            float *vin[2], *vout[2];
+            size_t applied      = 0;
+            job->nStatus        = setup_host(&host, job->pSrc, job->sPreset, job->nBlockSize, &applied, vin, vout);
+            if (job->nStatus != STATUS_OK)
+                return job->nStatus;
+            if (size_t(host.latency()) != job->nLatency)
+                return job->nStatus = STATUS_BAD_STATE;
+
+            // Each job writes to its own range of the destination sample
+            render_span(&host, vin, vout, job->pSrc, job->pDst,
+                job->nFirst, job->nStart, job->nEnd, job->nLatency, job->nBlockSize);
+
+            return STATUS_OK;
+        }
+
+        status_t render_sample_chunked(dspu::Sample *dst, dspu::Sample *src, const char *preset,
+            const chunk_params_t *params, chunk_stats_t *stats)
+        {
+            const size_t channels   = src->channels();
+            const size_t length     = src->length();
+            const size_t block_size = lsp_max(params->block_size, size_t(1));
+
+            // Probe the configured plugin for the latency and settle time
+            size_t latency, applied, preroll;
+            {
+                PluginHost host;
+                float *vin[2], *vout[2];
+                status_t res        = setup_host(&host, src, preset, block_size, &applied, vin, vout);
+                if (res != STATUS_OK)
+                    return res;
+
+                latency             = host.latency();
+                preroll             = (params->preroll >= 0) ? size_t(params->preroll) : settle_time(&host);
+            }
+
+            // Chunk boundaries and pre-roll are aligned to the block grid of the serial render
+            preroll                 = align_up(preroll, block_size);
+            const size_t chunk_size = align_up(lsp_max((length + params->chunks - 1) / lsp_max(params->chunks, size_t(1)), size_t(1)), block_size);
+            const size_t chunks     = lsp_max((length + chunk_size - 1) / chunk_size, size_t(1));
+
+            if (!dst->init(channels, length, length))
+                return STATUS_NO_MEM;
+            dst->set_sample_rate(src->sample_rate());
+
+            chunk_job_t *jobs       = static_cast<chunk_job_t *>(malloc(chunks * sizeof(chunk_job_t)));
+            ipc::Thread **threads   = static_cast<ipc::Thread **>(malloc(chunks * sizeof(ipc::Thread *)));
+            lsp_finally {
+                free(jobs);
+                free(threads);
+            };
+            if ((jobs == NULL) || (threads == NULL))
+                return STATUS_NO_MEM;
+
+            for (size_t i=0; i<chunks; ++i)
+            {
+                chunk_job_t *job    = &jobs[i];
+                job->pSrc           = src;
+                job->pDst           = dst;
+                job->sPreset        = preset;
+                job->nBlockSize     = block_size;
+                job->nStart         = i * chunk_size;
+                job->nEnd           = lsp_min(job->nStart + chunk_size, length);
+                job->nFirst         = (job->nStart > preroll) ? job->nStart - preroll : 0;
+                job->nLatency       = latency;
+                job->nStatus        = STATUS_OK;
+                threads[i]          = NULL;
+            }
+
+            // Render chunks concurrently
+            status_t res            = STATUS_OK;
+            const double start      = precise_time();
+            for (size_t i=0; i<chunks; ++i)
+            {
+                threads[i]          = new ipc::Thread(chunk_worker, &jobs[i]);
+                if (threads[i] == NULL)
+                {
+                    res                 = STATUS_NO_MEM;
+                    break;
+                }
+                if ((res = threads[i]->start()) != STATUS_OK)
+                {
+                    delete threads[i];
+                    threads[i]          = NULL;
+                    break;
+                }
+            }
+            for (size_t i=0; i<chunks; ++i)
+            {
+                if (threads[i] == NULL)
+                    continue;
+                threads[i]->join();
+                delete threads[i];
+                if ((res == STATUS_OK) && (jobs[i].nStatus != STATUS_OK))
+                    res                 = jobs[i].nStatus;
+            }
+            const double time       = precise_time() - start;
+            if (res != STATUS_OK)
+                return res;
+
+            if (stats == NULL)
+                return STATUS_OK;
+
+            stats->render.channels      = channels;
+            stats->render.sample_rate   = src->sample_rate();
+            stats->render.frames        = length;
+            stats->render.latency       = latency;
+            stats->render.params        = applied;
+            stats->render.seconds       = time;
+            stats->chunks               = chunks;
+            stats->preroll              = preroll;
+            stats->serial_seconds       = 0.0;
+            stats->seam_deviation       = 0.0f;
+            stats->seam_position        = 0;
+            stats->max_deviation        = 0.0f;
+
+            if (!params->verify)
+                return STATUS_OK;
+
+            // Compare with the serial render
+            dspu::Sample serial;
+            render_stats_t sstats;
+            if ((res = render_sample(&serial, src, preset, block_size, &sstats)) != STATUS_OK)
+                return res;
+            stats->serial_seconds       = sstats.seconds;
+
+            for (size_t ch=0; ch<channels; ++ch)
+            {
+                const float *a      = dst->channel(ch);
+                const float *b      = serial.channel(ch);
+
+                for (size_t i=0; i<length; ++i)
+                    stats->max_deviation    = lsp_max(stats->max_deviation, fabsf(a[i] - b[i]));
+
+                // The state of the chunk may differ from the serial render only until it settles
+                for (size_t i=1; i<chunks; ++i)
+                {
+                    const size_t first  = jobs[i].nStart;
+                    const size_t last   = lsp_min(first + lsp_max(preroll, block_size), length);
+                    for (size_t j=first; j<last; ++j)
+                    {
+                        const float d       = fabsf(a[j] - b[j]);
+                        if (d > stats->seam_deviation)
+                        {
+                            stats->seam_deviation   = d;
+                            stats->seam_position    = j;
+                        }
+                    }
+                }
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t render_file_chunked(const char *dst, const char *src, const char *preset,
+            const chunk_params_t *params, chunk_stats_t *stats)
+        {
+            dspu::Sample in, out;
+            status_t res = in.load(src);
+            if (res != STATUS_OK)
+                return res;
+
+            if ((res = render_sample_chunked(&out, &in, preset, params, stats)) != STATUS_OK)
+                return res;
+
+            const ssize_t written   = out.save(dst);
+            if (written < 0)
+                return status_t(-written);
+
+            return STATUS_OK;
+        }
+
+    } /* namespace test */
+} /* namespace lsp */
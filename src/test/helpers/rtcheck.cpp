@@ -0,0 +1,427 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/types.h>
+
+#include <private/test/rtcheck.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(PLATFORM_LINUX) && defined(__GLIBC__)
+    #define RTCHECK_INTERPOSE
+
+    #include <dlfcn.h>
+    #include <errno.h>
+    #include <new>
+    #include <poll.h>
+    #include <pthread.h>
+    #include <semaphore.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif /* PLATFORM_LINUX && __GLIBC__ */
+
+namespace lsp
+{
+    namespace test
+    {
+        static thread_local bool        rt_armed        = false;
+        static thread_local const char *rt_context      = NULL;
+        static uatomic_t                rt_counters[RT_TOTAL];
+        static uatomic_t                rt_first_set    = 0;
+        static char                     rt_first[256];
+
+        static const char *rt_violation_names[] =
+        {
+            "allocation",
+            "lock",
+            "syscall"
+        };
+
+        static void rt_check_init();
+
+        static void rt_record(rt_violation_t type, const char *function)
+        {
+            if (!rt_armed)
+                return;
+
+            // Disarm while recording to prevent recursion
+            rt_armed    = false;
+            atomic_add(&rt_counters[type], 1);
+            if (atomic_cas(&rt_first_set, 0, 1))
+                snprintf(rt_first, sizeof(rt_first), "%s: %s() called in %s",
+                    rt_violation_names[type], function, (rt_context != NULL) ? rt_context : "unknown context");
+            rt_armed    = true;
+        }
+
+        bool rt_check_supported()
+        {
+        #ifdef RTCHECK_INTERPOSE
+            return true;
+        #else
+            return false;
+        #endif /* RTCHECK_INTERPOSE */
+        }
+
+        void rt_check_reset()
+        {
+            rt_check_init();
+
+            for (size_t i=0; i<RT_TOTAL; ++i)
+                atomic_store(&rt_counters[i], 0);
+            rt_first[0]     = '\0';
+            atomic_store(&rt_first_set, 0);
+        }
+
+        void rt_check_begin(const char *context)
+        {
+            rt_check_init();
+            rt_context      = context;
+            rt_armed        = true;
+        }
+
+        void rt_check_end()
+        {
+            rt_armed        = false;
+            rt_context      = NULL;
+        }
+
+        size_t rt_check_violations(rt_violation_t type)
+        {
+            if ((type >= 0) && (type < RT_TOTAL))
+                return atomic_load(&rt_counters[type]);
+
+            size_t total = 0;
+            for (size_t i=0; i<RT_TOTAL; ++i)
+                total          += atomic_load(&rt_counters[i]);
+            return total;
+        }
+
+        const char *rt_check_first_violation()
+        {
+            return rt_first;
+        }
+
+    #ifdef RTCHECK_INTERPOSE
+        // Pointers to the original functions, resolved before the checker is armed
+        // because dlsym() may allocate memory itself
+        typedef int (* mutex_func_t)(pthread_mutex_t *);
+        typedef int (* mutex_timed_func_t)(pthread_mutex_t *, const struct timespec *);
+        typedef int (* cond_wait_func_t)(pthread_cond_t *, pthread_mutex_t *);
+        typedef int (* cond_timedwait_func_t)(pthread_cond_t *, pthread_mutex_t *, const struct timespec *);
+        typedef int (* rwlock_func_t)(pthread_rwlock_t *);
+        typedef int (* sem_func_t)(sem_t *);
+        typedef ssize_t (* read_func_t)(int, void *, size_t);
+        typedef ssize_t (* write_func_t)(int, const void *, size_t);
+        typedef int (* close_func_t)(int);
+        typedef int (* fsync_func_t)(int);
+        typedef int (* nanosleep_func_t)(const struct timespec *, struct timespec *);
+        typedef int (* clock_nanosleep_func_t)(clockid_t, int, const struct timespec *, struct timespec *);
+        typedef int (* usleep_func_t)(useconds_t);
+        typedef int (* poll_func_t)(struct pollfd *, nfds_t, int);
+        typedef int (* sched_yield_func_t)();
+
+        static mutex_func_t             real_pthread_mutex_lock         = NULL;
+        static mutex_timed_func_t       real_pthread_mutex_timedlock    = NULL;
+        static cond_wait_func_t         real_pthread_cond_wait          = NULL;
+        static cond_timedwait_func_t    real_pthread_cond_timedwait     = NULL;
+        static rwlock_func_t            real_pthread_rwlock_rdlock      = NULL;
+        static rwlock_func_t            real_pthread_rwlock_wrlock      = NULL;
+        static sem_func_t               real_sem_wait                   = NULL;
+        static read_func_t              real_read                       = NULL;
+        static write_func_t             real_write                      = NULL;
+        static close_func_t             real_close                      = NULL;
+        static fsync_func_t             real_fsync                      = NULL;
+        static nanosleep_func_t         real_nanosleep                  = NULL;
+        static clock_nanosleep_func_t   real_clock_nanosleep            = NULL;
+        static usleep_func_t            real_usleep                     = NULL;
+        static poll_func_t              real_poll                       = NULL;
+        static sched_yield_func_t       real_sched_yield                = NULL;
+
+        template <class F>
+        static inline void resolve(F *dst, const char *name)
+        {
+            if (*dst == NULL)
+                *dst        = reinterpret_cast<F>(dlsym(RTLD_NEXT, name));
+        }
+
+        static void rt_check_init()
+        {
+            resolve(&real_pthread_mutex_lock, "pthread_mutex_lock");
+            resolve(&real_pthread_mutex_timedlock, "pthread_mutex_timedlock");
+            resolve(&real_pthread_cond_wait, "pthread_cond_wait");
+            resolve(&real_pthread_cond_timedwait, "pthread_cond_timedwait");
+            resolve(&real_pthread_rwlock_rdlock, "pthread_rwlock_rdlock");
+            resolve(&real_pthread_rwlock_wrlock, "pthread_rwlock_wrlock");
+            resolve(&real_sem_wait, "sem_wait");
+            resolve(&real_read, "read");
+            resolve(&real_write, "write");
+            resolve(&real_close, "close");
+            resolve(&real_fsync, "fsync");
+            resolve(&real_nanosleep, "nanosleep");
+            resolve(&real_clock_nanosleep, "clock_nanosleep");
+            resolve(&real_usleep, "usleep");
+            resolve(&real_poll, "poll");
+            resolve(&real_sched_yield, "sched_yield");
+        }
+
+        template <class F>
+        static inline F lazy(F *fn, const char *name)
+        {
+            // Function may be called before rt_check_init(), resolve it without recording
+            if (*fn == NULL)
+            {
+                const bool armed    = rt_armed;
+                rt_armed            = false;
+                resolve(fn, name);
+                rt_armed            = armed;
+            }
+            return *fn;
+        }
+    #else
+        static void rt_check_init()
+        {
+        }
+    #endif /* RTCHECK_INTERPOSE */
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#ifdef RTCHECK_INTERPOSE
+
+using namespace lsp::test;
+
+extern "C"
+{
+    // GNU libc exports the original allocator under these names
+    extern void *__libc_malloc(size_t size);
+    extern void *__libc_calloc(size_t nmemb, size_t size);
+    extern void *__libc_realloc(void *ptr, size_t size);
+    extern void *__libc_memalign(size_t alignment, size_t size);
+    extern void __libc_free(void *ptr);
+
+    //-------------------------------------------------------------------------
+    // Memory allocator
+    void *malloc(size_t size) __THROW
+    {
+        rt_record(RT_ALLOC, "malloc");
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t nmemb, size_t size) __THROW
+    {
+        rt_record(RT_ALLOC, "calloc");
+        return __libc_calloc(nmemb, size);
+    }
+
+    void *realloc(void *ptr, size_t size) __THROW
+    {
+        rt_record(RT_ALLOC, "realloc");
+        return __libc_realloc(ptr, size);
+    }
+
+    void *memalign(size_t alignment, size_t size) __THROW
+    {
+        rt_record(RT_ALLOC, "memalign");
+        return __libc_memalign(alignment, size);
+    }
+
+    void *aligned_alloc(size_t alignment, size_t size) __THROW
+    {
+        rt_record(RT_ALLOC, "aligned_alloc");
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void **memptr, size_t alignment, size_t size) __THROW
+    {
+        rt_record(RT_ALLOC, "posix_memalign");
+        if ((alignment < sizeof(void *)) || (alignment & (alignment - 1)))
+            return EINVAL;
+        void *ptr       = __libc_memalign(alignment, size);
+        if (ptr == NULL)
+            return ENOMEM;
+        *memptr         = ptr;
+        return 0;
+    }
+
+    void free(void *ptr) __THROW
+    {
+        if (ptr != NULL)
+            rt_record(RT_ALLOC, "free");
+        __libc_free(ptr);
+    }
+
+    //-------------------------------------------------------------------------
+    // Synchronization primitives
+    int pthread_mutex_lock(pthread_mutex_t *mutex) __THROWNL
+    {
+        rt_record(RT_LOCK, "pthread_mutex_lock");
+        return lazy(&real_pthread_mutex_lock, "pthread_mutex_lock")(mutex);
+    }
+
+    int pthread_mutex_timedlock(pthread_mutex_t *mutex, const struct timespec *abstime) __THROWNL
+    {
+        rt_record(RT_LOCK, "pthread_mutex_timedlock");
+        return lazy(&real_pthread_mutex_timedlock, "pthread_mutex_timedlock")(mutex, abstime);
+    }
+
+    int pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex)
+    {
+        rt_record(RT_LOCK, "pthread_cond_wait");
+        return lazy(&real_pthread_cond_wait, "pthread_cond_wait")(cond, mutex);
+    }
+
+    int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex, const struct timespec *abstime)
+    {
+        rt_record(RT_LOCK, "pthread_cond_timedwait");
+        return lazy(&real_pthread_cond_timedwait, "pthread_cond_timedwait")(cond, mutex, abstime);
+    }
+
+    int pthread_rwlock_rdlock(pthread_rwlock_t *lock) __THROWNL
+    {
+        rt_record(RT_LOCK, "pthread_rwlock_rdlock");
+        return lazy(&real_pthread_rwlock_rdlock, "pthread_rwlock_rdlock")(lock);
+    }
+
+    int pthread_rwlock_wrlock(pthread_rwlock_t *lock) __THROWNL
+    {
+        rt_record(RT_LOCK, "pthread_rwlock_wrlock");
+        return lazy(&real_pthread_rwlock_wrlock, "pthread_rwlock_wrlock")(lock);
+    }
+
+    int sem_wait(sem_t *sem)
+    {
+        rt_record(RT_LOCK, "sem_wait");
+        return lazy(&real_sem_wait, "sem_wait")(sem);
+    }
+
+    //-------------------------------------------------------------------------
+    // Blocking system calls
+    ssize_t read(int fd, void *buf, size_t count)
+    {
+        rt_record(RT_SYSCALL, "read");
+        return lazy(&real_read, "read")(fd, buf, count);
+    }
+
+    ssize_t write(int fd, const void *buf, size_t count)
+    {
+        rt_record(RT_SYSCALL, "write");
+        return lazy(&real_write, "write")(fd, buf, count);
+    }
+
+    int close(int fd)
+    {
+        rt_record(RT_SYSCALL, "close");
+        return lazy(&real_close, "close")(fd);
+    }
+
+    int fsync(int fd)
+    {
+        rt_record(RT_SYSCALL, "fsync");
+        return lazy(&real_fsync, "fsync")(fd);
+    }
+
+    int nanosleep(const struct timespec *req, struct timespec *rem)
+    {
+        rt_record(RT_SYSCALL, "nanosleep");
+        return lazy(&real_nanosleep, "nanosleep")(req, rem);
+    }
+
+    int clock_nanosleep(clockid_t clockid, int flags, const struct timespec *req, struct timespec *rem)
+    {
+        rt_record(RT_SYSCALL, "clock_nanosleep");
+        return lazy(&real_clock_nanosleep, "clock_nanosleep")(clockid, flags, req, rem);
+    }
+
+    int usleep(useconds_t usec)
+    {
+        rt_record(RT_SYSCALL, "usleep");
+        return lazy(&real_usleep, "usleep")(usec);
+    }
+
+    int poll(struct pollfd *fds, nfds_t nfds, int timeout)
+    {
+        rt_record(RT_SYSCALL, "poll");
+        return lazy(&real_poll, "poll")(fds, nfds, timeout);
+    }
+
+    int sched_yield() __THROW
+    {
+        rt_record(RT_SYSCALL, "sched_yield");
+        return lazy(&real_sched_yield, "sched_yield")();
+    }
+} /* extern "C" */
+
+//-----------------------------------------------------------------------------
+// C++ allocator, forwarded to the interposed malloc() and free()
+void *operator new(size_t size)
+{
+    return malloc((size > 0) ? size : 1);
+}
+
+void *operator new[](size_t size)
+{
+    return malloc((size > 0) ? size : 1);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return malloc((size > 0) ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return malloc((size > 0) ? size : 1);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    free(ptr);
+}
+
+#endif /* RTCHECK_INTERPOSE */
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#include <private/test/signal.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        static const char *signal_names[] =
+        {
+            "noise",
+            "sweep",
+            "transients",
+            "corpus"
+        };
+
+        // Simple 32-bit LCG: we do not rely on libc rand() to keep signals reproducible
+        static inline uint32_t next_random(uint32_t *state)
+        {
+            *state      = (*state) * 1664525u + 1013904223u;
+            return *state;
+        }
+
+        static inline float next_float(uint32_t *state)
+        {
+            return float(next_random(state) >> 8) / float(1 << 24);
+        }
+
+        const char *signal_name(signal_kind_t kind)
+        {
+            return ((kind >= 0) && (kind < SIG_TOTAL)) ? signal_names[kind] : "unknown";
+        }
+
+        void generate_noise(float *dst, size_t count, uint32_t seed, float amplitude)
+        {
+            uint32_t state  = seed;
+            for (size_t i=0; i<count; ++i)
+                dst[i]          = (next_float(&state) * 2.0f - 1.0f) * amplitude;
+        }
+
+        void generate_sweep(float *dst, size_t count, size_t sample_rate, float amplitude)
+        {
+            const double f1     = 20.0;
+            const double f2     = 20000.0;
+            const double t      = double(count) / double(sample_rate);
+            const double k      = log(f2 / f1);
+            const double w      = 2.0 * M_PI * f1 * t / k;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                const double x      = double(i) / double(count);
+                dst[i]              = amplitude * sin(w * (exp(x * k) - 1.0));
+            }
+        }
+
+        void generate_transients(float *dst, size_t count, size_t sample_rate, uint32_t seed, float amplitude)
+        {
+            uint32_t state      = seed;
+            const size_t period = sample_rate / 8;      // 8 hits per second
+            double phase        = 0.0;
+            double freq         = 0.0;
+            double decay        = 0.0;
+            double level        = 0.0;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                if ((i % period) == 0)
+                {
+                    // Start new hit
+                    freq            = 40.0 + next_float(&state) * 4000.0;
+                    decay           = exp(-1.0 / (sample_rate * (0.005 + next_float(&state) * 0.1)));
+                    level           = 0.25 + next_float(&state) * 0.75;
+                    phase           = 0.0;
+                }
+
+                // Tonal body with a bit of noise for the attack
+                const float noise   = (next_float(&state) * 2.0f - 1.0f) * level * decay;
+                dst[i]              = amplitude * (level * sin(phase) + noise * 0.25f);
+                phase              += 2.0 * M_PI * freq / sample_rate;
+                level              *= decay;
+            }
+        }
+
+        void generate_signal(signal_kind_t kind, float *dst, size_t count, size_t sample_rate, uint32_t seed)
+        {
+            switch (kind)
+            {
+                case SIG_NOISE:
+                    generate_noise(dst, count, seed, 1.0f);
+                    break;
+                case SIG_SWEEP:
+                    generate_sweep(dst, count, sample_rate, 1.0f);
+                    break;
+                case SIG_TRANSIENTS:
+                    generate_transients(dst, count, sample_rate, seed, 1.0f);
+                    break;
+                case SIG_CORPUS:
+                default:
+                {
+                    const size_t part   = count / 3;
+                    generate_noise(dst, part, seed, 1.0f);
+                    generate_sweep(&dst[part], part, sample_rate, 1.0f);
+                    generate_transients(&dst[part*2], count - part*2, sample_rate, seed, 1.0f);
+                    break;
+                }
+            }
+        }
+
+    } /* namespace test */
+} /* namespace lsp */
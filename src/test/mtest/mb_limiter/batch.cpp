@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+ */
+
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <lsp-plug.in/test-fw/mtest.h>
+
+#include <stdlib.h>
+
+#include <private/test/batch.h>
+
+namespace
+{
+    static constexpr size_t DEFAULT_BLOCK   = 0x2000;
+    static constexpr size_t MAX_THREADS     = 256;
+}
+
+MTEST_BEGIN("mb_limiter", "batch")
+
+    void usage()
+    {
+        printf("Batch render of audio files through the multiband limiter\n");
+        printf("Arguments: [-j threads] [-b block-size] manifest ...\n");
+        printf("  -j    number of worker threads, default: number of CPUs\n");
+        printf("  -b    size of the processing block in samples, default: %d\n", int(DEFAULT_BLOCK));
+        printf("Each line of the manifest contains the input file, the preset and the output file\n");
+        printf("separated by whitespaces, the preset '-' means default settings\n");
+    }
+
+    MTEST_MAIN
+    {
+        size_t threads      = ipc::Thread::system_cpus();
+        size_t block_size   = DEFAULT_BLOCK;
+        test::BatchRenderer batch;
+        size_t manifests    = 0;
+
+        // Parse arguments
+        for (int i=0; i<argc; ++i)
+        {
+            const char *arg     = argv[i];
+            if ((!strcmp(arg, "-j")) && (i + 1 < argc))
+                threads     = lsp_limit(atoi(argv[++i]), 1, int(MAX_THREADS));
+            else if ((!strcmp(arg, "-b")) && (i + 1 < argc))
+                block_size  = lsp_max(atoi(argv[++i]), 1);
+            else if ((!strcmp(arg, "-h")) || (!strcmp(arg, "--help")))
+            {
+                usage();
+                return;
+            }
+            else
+            {
+                MTEST_ASSERT_MSG(batch.load_manifest(arg) == STATUS_OK, "Failed to load manifest %s", arg);
+                ++manifests;
+            }
+        }
+
+        if (manifests <= 0)
+        {
+            usage();
+            return;
+        }
+
+        test::batch_stats_t stats;
+        MTEST_ASSERT(batch.run(lsp_max(threads, size_t(1)), block_size, &stats) == STATUS_OK);
+
+        // Report results
+        double audio        = 0.0;
+        for (size_t i=0, n=batch.jobs(); i<n; ++i)
+        {
+            const test::batch_job_t *job = batch.job(i);
+            if (job->status != STATUS_OK)
+            {
+                printf("FAILED %s: error %d\n", job->src, int(job->status));
+                continue;
+            }
+
+            const test::render_stats_t *st = &job->stats;
+            const double duration   = double(st->frames) / double(st->sample_rate);
+            audio                  += duration;
+            printf("%s -> %s: %d ch, %d Hz, %.2f s, latency %d, %d params, %s instance, %.2fx realtime\n",
+                job->src, job->dst, int(st->channels), int(st->sample_rate), duration,
+                int(st->latency), int(st->params), (job->reused) ? "reused" : "new",
+                duration / lsp_max(st->seconds, 1e-9));
+        }
+
+        printf("Rendered %d of %d jobs, %.2f s of audio in %.2f s using %d threads\n",
+            int(stats.jobs - stats.failed), int(stats.jobs), audio, stats.seconds, int(stats.threads));
+        printf("Plugin instances created: %d, jobs on reused instances: %d, stolen jobs: %d\n",
+            int(stats.instances), int(stats.reused), int(stats.stolen));
+        MTEST_ASSERT(stats.failed == 0);
+    }
+
+MTEST_END
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <lsp-plug.in/test-fw/mtest.h>
+
+#include <stdlib.h>
+
+#include <private/test/bench.h>
+#include <private/test/render.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t DEFAULT_BLOCK   = 0x2000;
+    static constexpr size_t MAX_THREADS     = 64;
+
+    typedef struct render_job_t
+    {
+        const char             *sSrc;           // Source file
+        char                    sDst[1024];     // Destination file
+        status_t                nStatus;        // Result of rendering
+        test::render_stats_t    sStats;         // Rendering statistics
+        test::chunk_stats_t     sChunk;         // Statistics of the chunked render
+    } render_job_t;
+
+    typedef struct render_batch_t
+    {
+        render_job_t           *vJobs;          // List of jobs
+        size_t                  nJobs;          // Number of jobs
+        uatomic_t               nNext;          // Next job to take
+        const char             *sPreset;        // Preset file
+        test::chunk_params_t    sChunk;         // Parameters of the chunked render
+    } render_batch_t;
+
+    static status_t render_worker(void *arg)
+    {
+        render_batch_t *batch = static_cast<render_batch_t *>(arg);
+
+        while (true)
+        {
+            const size_t idx    = atomic_add(&batch->nNext, 1);
+            if (idx >= batch->nJobs)
+                break;
+
+            render_job_t *job   = &batch->vJobs[idx];
+            if (batch->sChunk.chunks > 1)
+            {
+                job->nStatus        = test::render_file_chunked(job->sDst, job->sSrc, batch->sPreset, &batch->sChunk, &job->sChunk);
+                job->sStats         = job->sChunk.render;
+            }
+            else
+                job->nStatus        = test::render_file(job->sDst, job->sSrc, batch->sPreset, batch->sChunk.block_size, &job->sStats);
+        }
+
+        return STATUS_OK;
+    }
+
+    static void make_output_path(char *dst, size_t size, const char *outdir, const char *src)
+    {
+        const char *name    = strrchr(src, FILE_SEPARATOR_C);
+        name                = (name != NULL) ? name + 1 : src;
+
+        if (outdir != NULL)
+            snprintf(dst, size, "%s" FILE_SEPARATOR_S "%s", outdir, name);
+        else
+        {
+            // Insert '.limited' suffix before extension
+            const char *ext     = strrchr(name, '.');
+            const int base      = (ext != NULL) ? int(ext - src) : int(strlen(src));
+            snprintf(dst, size, "%.*s.limited%s", base, src, (ext != NULL) ? ext : ".wav");
+        }
+    }
+}
+
+MTEST_BEGIN("mb_limiter", "render")
+
+    void usage()
+    {
+        printf("Offline render of audio files through the multiband limiter\n");
+        printf("Arguments: [-p preset.cfg] [-o output-dir] [-j threads] [-b block-size] [-c chunks] [-r preroll] [-v] file ...\n");
+        printf("  -p    preset in the plain-text configuration format (see res/doc/configs)\n");
+        printf("  -o    directory for output files, by default '.limited' suffix is added to the file name\n");
+        printf("  -j    number of files rendered concurrently, default: 1\n");
+        printf("  -b    size of the processing block in samples, default: %d\n", int(DEFAULT_BLOCK));
+        printf("  -c    number of chunks of each file rendered concurrently, default: 1\n");
+        printf("  -r    pre-roll of each chunk in samples, by default selected from the preset\n");
+        printf("  -v    compare the chunked render with the serial render and report seam deviation\n");
+    }
+
+    MTEST_MAIN
+    {
+        const char *preset  = NULL;
+        const char *outdir  = NULL;
+        size_t threads      = 1;
+        size_t block_size   = DEFAULT_BLOCK;
+        size_t chunks       = 1;
+        ssize_t preroll     = -1;
+        bool verify         = false;
+        lltl::parray<char> files;
+
+        // Parse arguments
+        for (int i=0; i<argc; ++i)
+        {
+            const char *arg     = argv[i];
+            if ((!strcmp(arg, "-p")) && (i + 1 < argc))
+                preset      = argv[++i];
+            else if ((!strcmp(arg, "-o")) && (i + 1 < argc))
+                outdir      = argv[++i];
+            else if ((!strcmp(arg, "-j")) && (i + 1 < argc))
+                threads     = lsp_limit(atoi(argv[++i]), 1, int(MAX_THREADS));
+            else if ((!strcmp(arg, "-b")) && (i + 1 < argc))
+                block_size  = lsp_max(atoi(argv[++i]), 1);
+            else if ((!strcmp(arg, "-c")) && (i + 1 < argc))
+                chunks      = lsp_limit(atoi(argv[++i]), 1, int(MAX_THREADS));
+            else if ((!strcmp(arg, "-r")) && (i + 1 < argc))
+                preroll     = lsp_max(atoi(argv[++i]), 0);
+            else if (!strcmp(arg, "-v"))
+                verify      = true;
+            else if ((!strcmp(arg, "-h")) || (!strcmp(arg, "--help")))
+            {
+                usage();
+                return;
+            }
+            else
+                MTEST_ASSERT(files.add(const_cast<char *>(arg)));
+        }
+
+        if (files.is_empty())
+        {
+            usage();
+            return;
+        }
+
+        // Prepare jobs
+        render_batch_t batch;
+        batch.nJobs         = files.size();
+        batch.vJobs         = static_cast<render_job_t *>(malloc(batch.nJobs * sizeof(render_job_t)));
+        MTEST_ASSERT(batch.vJobs != NULL);
+        lsp_finally { free(batch.vJobs); };
+        batch.nNext         = 0;
+        batch.sPreset       = preset;
+        batch.sChunk.block_size = block_size;
+        batch.sChunk.chunks     = chunks;
+        batch.sChunk.preroll    = preroll;
+        batch.sChunk.verify     = verify;
+
+        for (size_t i=0; i<batch.nJobs; ++i)
+        {
+            render_job_t *job   = &batch.vJobs[i];
+            job->sSrc           = files.uget(i);
+            job->nStatus        = STATUS_OK;
+            make_output_path(job->sDst, sizeof(job->sDst), outdir, job->sSrc);
+        }
+
+        // Run workers
+        threads             = lsp_min(threads, batch.nJobs);
+        ipc::Thread *workers[MAX_THREADS];
+        const double start  = test::precise_time();
+
+        for (size_t i=0; i<threads; ++i)
+        {
+            workers[i]          = new ipc::Thread(render_worker, &batch);
+            MTEST_ASSERT(workers[i] != NULL);
+            MTEST_ASSERT(workers[i]->start() == STATUS_OK);
+        }
+        for (size_t i=0; i<threads; ++i)
+        {
+            workers[i]->join();
+            delete workers[i];
+        }
+
+        const double time   = test::precise_time() - start;
+
+        // Report results
+        size_t failed       = 0;
+        double audio        = 0.0;
+        for (size_t i=0; i<batch.nJobs; ++i)
+        {
+            const render_job_t *job = &batch.vJobs[i];
+            if (job->nStatus != STATUS_OK)
+            {
+                printf("FAILED %s: error %d\n", job->sSrc, int(job->nStatus));
+                ++failed;
+                continue;
+            }
+
+            const test::render_stats_t *st = &job->sStats;
+            const double duration   = double(st->frames) / double(st->sample_rate);
+            audio                  += duration;
+            printf("%s -> %s: %d ch, %d Hz, %.2f s, latency %d, %d params, %.2fx realtime\n",
+                job->sSrc, job->sDst, int(st->channels), int(st->sample_rate), duration,
+                int(st->latency), int(st->params), duration / lsp_max(st->seconds, 1e-9));
+
+            if (chunks <= 1)
+                continue;
+            const test::chunk_stats_t *cs = &job->sChunk;
+            printf("  %d chunks, pre-roll %d samples\n", int(cs->chunks), int(cs->preroll));
+            if (verify)
+                printf("  serial render %.2fx realtime, max seam deviation %.2f dB at frame %d, max deviation %.2f dB\n",
+                    duration / lsp_max(cs->serial_seconds, 1e-9),
+                    dspu::gain_to_db(lsp_max(cs->seam_deviation, 1e-20f)), int(cs->seam_position),
+                    dspu::gain_to_db(lsp_max(cs->max_deviation, 1e-20f)));
+        }
+
+        printf("Rendered %d of %d files, %.2f s of audio in %.2f s using %d threads\n",
+            int(batch.nJobs - failed), int(batch.nJobs), audio, time, int(threads));
+        MTEST_ASSERT(failed == 0);
+    }
+
+MTEST_END
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/bench.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t SIGNAL_LENGTH   = SAMPLE_RATE * 4;      // 4 seconds of automation per scenario
+    static constexpr size_t MAX_BLOCK       = 256;
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        &meta::sc_mb_limiter_mono,
+        &meta::sc_mb_limiter_stereo,
+        NULL
+    };
+
+    static const size_t block_sizes[] = { 32, 64, 256 };
+
+    enum automation_t
+    {
+        AUTO_SPLIT_SWEEP    = 1 << 0,       // Split frequencies sweep every block
+        AUTO_SPLIT_TOGGLE   = 1 << 1,       // Split enables toggle
+        AUTO_OVS_FLIP       = 1 << 2,       // Oversampling mode flips
+        AUTO_XOVER_FLIP     = 1 << 3,       // Crossover mode flips
+        AUTO_LOOKAHEAD      = 1 << 4,       // Lookahead changes
+
+        AUTO_ALL            = AUTO_SPLIT_SWEEP | AUTO_SPLIT_TOGGLE | AUTO_OVS_FLIP | AUTO_XOVER_FLIP | AUTO_LOOKAHEAD
+    };
+
+    typedef struct scenario_t
+    {
+        const char *name;
+        size_t      flags;
+    } scenario_t;
+
+    static const scenario_t scenarios[] =
+    {
+        { "none",           0                   },
+        { "split_sweep",    AUTO_SPLIT_SWEEP    },
+        { "split_toggle",   AUTO_SPLIT_TOGGLE   },
+        { "ovs_flip",       AUTO_OVS_FLIP       },
+        { "xover_flip",     AUTO_XOVER_FLIP     },
+        { "lookahead",      AUTO_LOOKAHEAD      },
+        { "all",            AUTO_ALL            },
+        { NULL,             0                   }
+    };
+}
+
+PTEST_BEGIN("mb_limiter", "automation", 0, 0)
+
+    double *vUpdate;
+    double *vProcess;
+
+    // Apply automation for the specified block index
+    void automate(test::PluginHost *host, size_t flags, size_t block, size_t blocks_per_second)
+    {
+        char id[32];
+        const float t   = float(block) / float(blocks_per_second);
+
+        if (flags & AUTO_SPLIT_SWEEP)
+        {
+            // Each split sweeps around its default position with different rate
+            for (size_t i=0; i<meta::mb_limiter::BANDS_MAX-1; ++i)
+            {
+                snprintf(id, sizeof(id), "sf_%d", int(i + 1));
+                const float base    = 40.0f * powf(2.5f, i);
+                host->set(id, base * (1.0f + 0.5f * sinf(2.0f * M_PI * t * (0.5f + i * 0.25f))));
+            }
+        }
+
+        if ((flags & AUTO_SPLIT_TOGGLE) && ((block % 8) == 0))
+        {
+            const size_t split  = (block / 8) % (meta::mb_limiter::BANDS_MAX - 1);
+            snprintf(id, sizeof(id), "se_%d", int(split + 1));
+            host->set(id, (host->get(id) >= 0.5f) ? 0.0f : 1.0f);
+        }
+
+        if ((flags & AUTO_OVS_FLIP) && ((block % 64) == 0))
+        {
+            const size_t ovs    = (block / 64) % (meta::mb_limiter::OVS_TRUE_PEAK_24BIT + 1);
+            host->set("ovs", ovs);
+        }
+
+        if ((flags & AUTO_XOVER_FLIP) && ((block % 48) == 0))
+            host->set("mode", (block / 48) & 1);
+
+        if ((flags & AUTO_LOOKAHEAD) && ((block % 4) == 0))
+        {
+            const float k       = 0.5f + 0.5f * sinf(2.0f * M_PI * t);
+            host->set("lk", meta::mb_limiter::LOOKAHEAD_MIN +
+                k * (meta::mb_limiter::LOOKAHEAD_MAX - meta::mb_limiter::LOOKAHEAD_MIN));
+        }
+    }
+
+    void print_stats(const char *what, const test::time_stats_t *st)
+    {
+        printf("    %-8s p50=%8.2f us p99=%8.2f us p99.9=%8.2f us max=%9.2f us mean=%8.2f us\n",
+            what, st->p50 * 1e+6, st->p99 * 1e+6, st->p999 * 1e+6, st->max * 1e+6, st->mean * 1e+6);
+    }
+
+    void bench(test::ResultWriter *out, const meta::plugin_t *meta, const float *signal,
+        const scenario_t *sc, size_t block_size)
+    {
+        test::PluginHost host;
+        PTEST_ASSERT(host.init(meta, SAMPLE_RATE, MAX_BLOCK) == STATUS_OK);
+        host.set("g_in", GAIN_AMP_P_6_DB);
+        host.update_settings();
+
+        const size_t blocks             = SIGNAL_LENGTH / block_size;
+        const size_t blocks_per_second  = SAMPLE_RATE / block_size;
+        size_t updates                  = 0;
+
+        for (size_t i=0; i<blocks; ++i)
+        {
+            automate(&host, sc->flags, i, blocks_per_second);
+            host.fill_inputs(&signal[i * block_size], block_size);
+
+            // Time update_settings() only when the host would really call it
+            if (host.update_pending())
+            {
+                const double start  = test::precise_time();
+                host.update_settings();
+                vUpdate[updates++]  = test::precise_time() - start;
+            }
+
+            const double start  = test::precise_time();
+            host.process(block_size);
+            vProcess[i]     = test::precise_time() - start;
+        }
+
+        test::time_stats_t su, sp;
+        test::compute_stats(&su, vUpdate, updates);
+        test::compute_stats(&sp, vProcess, blocks);
+
+        const double budget = double(block_size) / double(SAMPLE_RATE);
+        printf("  %-14s block=%-4d (budget %.2f us)\n", sc->name, int(block_size), budget * 1e+6);
+        print_stats("update", &su);
+        print_stats("process", &sp);
+
+        out->write("%s,%s,%d,update,%d,%.3f,%.3f,%.3f,%.3f,%.3f",
+            meta->uid, sc->name, int(block_size), int(su.count),
+            su.mean * 1e+6, su.p50 * 1e+6, su.p99 * 1e+6, su.p999 * 1e+6, su.max * 1e+6);
+        out->write("%s,%s,%d,process,%d,%.3f,%.3f,%.3f,%.3f,%.3f",
+            meta->uid, sc->name, int(block_size), int(sp.count),
+            sp.mean * 1e+6, sp.p50 * 1e+6, sp.p99 * 1e+6, sp.p999 * 1e+6, sp.max * 1e+6);
+    }
+
+    PTEST_MAIN
+    {
+        const size_t max_blocks = SIGNAL_LENGTH / block_sizes[0];
+
+        float *signal       = static_cast<float *>(malloc(SIGNAL_LENGTH * sizeof(float)));
+        vUpdate             = static_cast<double *>(malloc(max_blocks * sizeof(double)));
+        vProcess            = static_cast<double *>(malloc(max_blocks * sizeof(double)));
+        PTEST_ASSERT((signal != NULL) && (vUpdate != NULL) && (vProcess != NULL));
+        lsp_finally {
+            free(signal);
+            free(vUpdate);
+            free(vProcess);
+        };
+
+        test::generate_signal(test::SIG_CORPUS, signal, SIGNAL_LENGTH, SAMPLE_RATE, 0x5eed);
+
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/ptest-mb_limiter-automation.csv", tempdir());
+        test::ResultWriter out;
+        PTEST_ASSERT(out.open(path,
+            "plugin,scenario,block,call,count,mean_us,p50_us,p99_us,p999_us,max_us") == STATUS_OK);
+
+        for (const meta::plugin_t * const *pmeta = variants; *pmeta != NULL; ++pmeta)
+        {
+            printf("Benchmarking %s...\n", (*pmeta)->uid);
+
+            for (const scenario_t *sc = scenarios; sc->name != NULL; ++sc)
+                for (size_t i=0; i<sizeof(block_sizes)/sizeof(size_t); ++i)
+                    bench(&out, *pmeta, signal, sc, block_sizes[i]);
+
+            PTEST_SEPARATOR;
+        }
+
+        printf("Results have been written to: %s\n", path);
+    }
+
+PTEST_END
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/bench.h>
+#include <private/test/PluginHost.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t BLOCK_SIZE      = 1024;
+    static constexpr size_t INSTANCES       = 32;       // Instances kept alive to measure memory growth
+    static constexpr size_t ITERATIONS      = 64;       // Number of sample rate changes and rebuilds
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        &meta::sc_mb_limiter_mono,
+        &meta::sc_mb_limiter_stereo,
+        NULL
+    };
+
+    static const size_t sample_rates[] =
+    {
+        44100, 48000, 88200, 96000, 176400, 192000
+    };
+}
+
+PTEST_BEGIN("mb_limiter", "lifecycle", 0, 0)
+
+    double *vTimes;
+
+    void report(test::ResultWriter *out, const meta::plugin_t *meta, const char *phase, size_t count,
+        const test::resource_usage_t *before, const test::resource_usage_t *after)
+    {
+        test::time_stats_t st;
+        test::compute_stats(&st, vTimes, count);
+
+        const size_t rss    = after->peak_rss - before->peak_rss;
+        const size_t minflt = after->minor_faults - before->minor_faults;
+        const size_t majflt = after->major_faults - before->major_faults;
+
+        printf("  %-24s mean=%8.3f ms p50=%8.3f ms max=%8.3f ms, peak RSS +%d KB, page faults +%d/%d\n",
+            phase, st.mean * 1e+3, st.p50 * 1e+3, st.max * 1e+3,
+            int(rss), int(minflt), int(majflt));
+        out->write("%s,%s,%d,%.6f,%.6f,%.6f,%d,%d,%d",
+            meta->uid, phase, int(count),
+            st.mean * 1e+3, st.p50 * 1e+3, st.max * 1e+3,
+            int(rss), int(minflt), int(majflt));
+    }
+
+    void bench_instantiation(test::ResultWriter *out, const meta::plugin_t *meta)
+    {
+        test::resource_usage_t r0, r1, r2, r3, r4;
+        test::PluginHost *hosts = new test::PluginHost[INSTANCES];
+        PTEST_ASSERT(hosts != NULL);
+        lsp_finally { delete [] hosts; };
+
+        // Constructor and init(): arena allocation and initialization of limiters
+        test::get_resource_usage(&r0);
+        for (size_t i=0; i<INSTANCES; ++i)
+        {
+            const double start  = test::precise_time();
+            PTEST_ASSERT(hosts[i].create(meta, BLOCK_SIZE) == STATUS_OK);
+            vTimes[i]           = test::precise_time() - start;
+        }
+        test::get_resource_usage(&r1);
+        report(out, meta, "init", INSTANCES, &r0, &r1);
+
+        // Sample rate set-up and activation: FFT crossovers, oversamplers, analyzer
+        for (size_t i=0; i<INSTANCES; ++i)
+        {
+            const double start  = test::precise_time();
+            hosts[i].start(SAMPLE_RATE);
+            vTimes[i]           = test::precise_time() - start;
+        }
+        test::get_resource_usage(&r2);
+        report(out, meta, "set_sample_rate", INSTANCES, &r1, &r2);
+
+        // First call of update_settings(): builds the band plan and all filters
+        for (size_t i=0; i<INSTANCES; ++i)
+        {
+            const double start  = test::precise_time();
+            hosts[i].update_settings();
+            vTimes[i]           = test::precise_time() - start;
+        }
+        test::get_resource_usage(&r3);
+        report(out, meta, "first_update", INSTANCES, &r2, &r3);
+
+        // Destruction
+        for (size_t i=0; i<INSTANCES; ++i)
+        {
+            const double start  = test::precise_time();
+            hosts[i].destroy();
+            vTimes[i]           = test::precise_time() - start;
+        }
+        test::get_resource_usage(&r4);
+        report(out, meta, "destroy", INSTANCES, &r3, &r4);
+    }
+
+    void bench_sample_rate(test::ResultWriter *out, const meta::plugin_t *meta, size_t xover)
+    {
+        test::resource_usage_t r0, r1;
+        test::PluginHost host;
+        PTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+        host.set("mode", xover);
+        host.update_settings();
+
+        // update_sample_rate() alone
+        test::get_resource_usage(&r0);
+        for (size_t i=0; i<ITERATIONS; ++i)
+        {
+            const size_t sr     = sample_rates[i % (sizeof(sample_rates)/sizeof(size_t))];
+            const double start  = test::precise_time();
+            host.set_sample_rate(sr);
+            vTimes[i]           = test::precise_time() - start;
+            host.update_settings();
+        }
+        test::get_resource_usage(&r1);
+        report(out, meta, (xover) ? "sr_change_linear_phase" : "sr_change_classic", ITERATIONS, &r0, &r1);
+
+        // update_settings() after the sample rate change
+        test::get_resource_usage(&r0);
+        for (size_t i=0; i<ITERATIONS; ++i)
+        {
+            const size_t sr     = sample_rates[i % (sizeof(sample_rates)/sizeof(size_t))];
+            host.set_sample_rate(sr);
+            const double start  = test::precise_time();
+            host.update_settings();
+            vTimes[i]           = test::precise_time() - start;
+        }
+        test::get_resource_usage(&r1);
+        report(out, meta, (xover) ? "sr_update_linear_phase" : "sr_update_classic", ITERATIONS, &r0, &r1);
+    }
+
+    void bench_rebuild(test::ResultWriter *out, const meta::plugin_t *meta, size_t xover)
+    {
+        test::resource_usage_t r0, r1;
+        test::PluginHost host;
+        PTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+        host.set("mode", xover);
+        host.update_settings();
+
+        // Toggling the split forces rebuild of the band plan, filters and frequency charts
+        test::get_resource_usage(&r0);
+        for (size_t i=0; i<ITERATIONS; ++i)
+        {
+            host.set("se_3", (i & 1) ? 0.0f : 1.0f);
+            const double start  = test::precise_time();
+            host.update_settings();
+            vTimes[i]           = test::precise_time() - start;
+        }
+        test::get_resource_usage(&r1);
+        report(out, meta, (xover) ? "rebuild_linear_phase" : "rebuild_classic", ITERATIONS, &r0, &r1);
+
+        // Parameter change which does not rebuild the bands
+        test::get_resource_usage(&r0);
+        for (size_t i=0; i<ITERATIONS; ++i)
+        {
+            host.set("th", (i & 1) ? GAIN_AMP_M_6_DB : GAIN_AMP_M_12_DB);
+            const double start  = test::precise_time();
+            host.update_settings();
+            vTimes[i]           = test::precise_time() - start;
+        }
+        test::get_resource_usage(&r1);
+        report(out, meta, (xover) ? "update_linear_phase" : "update_classic", ITERATIONS, &r0, &r1);
+    }
+
+    PTEST_MAIN
+    {
+        vTimes              = static_cast<double *>(malloc(lsp_max(INSTANCES, ITERATIONS) * sizeof(double)));
+        PTEST_ASSERT(vTimes != NULL);
+        lsp_finally { free(vTimes); };
+
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/ptest-mb_limiter-lifecycle.csv", tempdir());
+        test::ResultWriter out;
+        PTEST_ASSERT(out.open(path,
+            "plugin,phase,count,mean_ms,p50_ms,max_ms,peak_rss_kb,minor_faults,major_faults") == STATUS_OK);
+
+        for (const meta::plugin_t * const *pmeta = variants; *pmeta != NULL; ++pmeta)
+        {
+            const meta::plugin_t *meta = *pmeta;
+            printf("Benchmarking %s...\n", meta->uid);
+
+            bench_instantiation(&out, meta);
+            for (size_t xover=0; xover < 2; ++xover)
+            {
+                bench_sample_rate(&out, meta, xover);
+                bench_rebuild(&out, meta, xover);
+            }
+
+            PTEST_SEPARATOR;
+        }
+
+        printf("Results have been written to: %s\n", path);
+    }
+
+PTEST_END
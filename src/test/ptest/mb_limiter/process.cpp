@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/bench.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t BLOCK_SIZE      = 1024;
+    static constexpr size_t SIGNAL_LENGTH   = SAMPLE_RATE;          // 1 second of synthetic corpus
+    static constexpr size_t WARMUP_LENGTH   = SAMPLE_RATE / 10;     // Settle delay lines and FFT frames
+    static constexpr size_t OVS_MODES       = meta::mb_limiter::OVS_TRUE_PEAK_24BIT + 1;
+
+    // Representative oversampling modes and band counts, all of them are swept with '--full'
+    static const size_t ovs_modes[] =
+    {
+        meta::mb_limiter::OVS_NONE,
+        meta::mb_limiter::OVS_HALF_2X16BIT,
+        meta::mb_limiter::OVS_FULL_4X16BIT,
+        meta::mb_limiter::OVS_FULL_8X24BIT,
+        meta::mb_limiter::OVS_TRUE_PEAK_24BIT
+    };
+
+    static const size_t band_counts[] = { 1, 2, 4, 8 };
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        &meta::sc_mb_limiter_mono,
+        &meta::sc_mb_limiter_stereo,
+        NULL
+    };
+
+    static const char *xover_names[] =
+    {
+        "classic",
+        "linear_phase"
+    };
+
+    const char *ovs_name(const meta::plugin_t *meta, size_t mode)
+    {
+        for (const meta::port_t *p = meta->ports; p->id != NULL; ++p)
+        {
+            if ((strcmp(p->id, "ovs") != 0) || (p->items == NULL))
+                continue;
+
+            for (size_t i=0; p->items[i].text != NULL; ++i)
+                if (i == mode)
+                    return p->items[i].text;
+        }
+        return "unknown";
+    }
+}
+
+PTEST_BEGIN("mb_limiter", "process", 0, 0)
+
+    typedef struct filter_t
+    {
+        bool        bFull;          // Sweep all oversampling modes and band counts
+        const char *sPlugin;        // Identifier of the plugin to benchmark, NULL for all
+        ssize_t     nXover;         // Crossover mode to benchmark, negative for all
+        ssize_t     nOvs;           // Oversampling mode to benchmark, negative for selected modes
+        ssize_t     nBands;         // Number of bands to benchmark, negative for selected counts
+    } filter_t;
+
+    void usage()
+    {
+        printf("Arguments:\n");
+        printf("  --full        sweep all oversampling modes and band counts\n");
+        printf("  -p <uid>      benchmark only the plugin with specified identifier\n");
+        printf("  -x <mode>     benchmark only the crossover mode: 0 - classic, 1 - linear phase\n");
+        printf("  -o <mode>     benchmark only the oversampling mode (index in the list of modes)\n");
+        printf("  -n <bands>    benchmark only the specified number of bands\n");
+    }
+
+    bool parse_args(filter_t *f, int argc, const char **argv)
+    {
+        f->bFull        = false;
+        f->sPlugin      = NULL;
+        f->nXover       = -1;
+        f->nOvs         = -1;
+        f->nBands       = -1;
+
+        for (int i=0; i<argc; ++i)
+        {
+            const char *arg     = argv[i];
+            if (!strcmp(arg, "--full"))
+                f->bFull        = true;
+            else if ((!strcmp(arg, "-p")) && (i + 1 < argc))
+                f->sPlugin      = argv[++i];
+            else if ((!strcmp(arg, "-x")) && (i + 1 < argc))
+                f->nXover       = lsp_limit(atoi(argv[++i]), 0, 1);
+            else if ((!strcmp(arg, "-o")) && (i + 1 < argc))
+                f->nOvs         = lsp_limit(atoi(argv[++i]), 0, int(OVS_MODES - 1));
+            else if ((!strcmp(arg, "-n")) && (i + 1 < argc))
+                f->nBands       = lsp_limit(atoi(argv[++i]), 1, int(meta::mb_limiter::BANDS_MAX));
+            else
+            {
+                usage();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ovs_selected(const filter_t *f, size_t ovs)
+    {
+        if (f->nOvs >= 0)
+            return ovs == size_t(f->nOvs);
+        if (f->bFull)
+            return true;
+        for (size_t i=0; i<sizeof(ovs_modes)/sizeof(size_t); ++i)
+            if (ovs_modes[i] == ovs)
+                return true;
+        return false;
+    }
+
+    bool bands_selected(const filter_t *f, size_t bands)
+    {
+        if (f->nBands >= 0)
+            return bands == size_t(f->nBands);
+        if (f->bFull)
+            return true;
+        for (size_t i=0; i<sizeof(band_counts)/sizeof(size_t); ++i)
+            if (band_counts[i] == bands)
+                return true;
+        return false;
+    }
+
+    void configure(test::PluginHost *host, size_t xover, size_t ovs, size_t bands, bool dither, bool analyzer)
+    {
+        char id[32];
+
+        host->reset_ports();
+        host->set("g_in", GAIN_AMP_P_6_DB);     // Make the limiters actually work
+        host->set("mode", xover);
+        host->set("ovs", ovs);
+        host->set("dither", (dither) ? meta::mb_limiter::DITHER_16BIT : meta::mb_limiter::DITHER_NONE);
+        host->set_all("ife", (analyzer) ? 1.0f : 0.0f);
+        host->set_all("ofe", (analyzer) ? 1.0f : 0.0f);
+
+        // Enable first (bands-1) splits, default split frequencies are already ascending
+        for (size_t i=0; i<meta::mb_limiter::BANDS_MAX-1; ++i)
+        {
+            snprintf(id, sizeof(id), "se_%d", int(i + 1));
+            host->set(id, (i < (bands - 1)) ? 1.0f : 0.0f);
+        }
+    }
+
+    void run(test::PluginHost *host, const float *signal, size_t count)
+    {
+        for (size_t offset=0; offset < count; )
+        {
+            const size_t to_do  = lsp_min(count - offset, BLOCK_SIZE);
+            host->fill_inputs(&signal[offset], to_do);
+            host->process(to_do);
+            offset             += to_do;
+        }
+    }
+
+    PTEST_MAIN
+    {
+        filter_t filter;
+        if (!parse_args(&filter, argc, argv))
+            return;
+
+        float *signal       = static_cast<float *>(malloc(SIGNAL_LENGTH * sizeof(float)));
+        PTEST_ASSERT(signal != NULL);
+        lsp_finally { free(signal); };
+
+        // Noise, sweep and transients in one reproducible buffer
+        test::generate_signal(test::SIG_CORPUS, signal, SIGNAL_LENGTH, SAMPLE_RATE, 0x5eed);
+
+        // Prepare machine-readable output
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/ptest-mb_limiter-process.csv", tempdir());
+        test::ResultWriter out;
+        PTEST_ASSERT(out.open(path,
+            "plugin,xover,ovs,bands,dither,analyzer,samples,seconds,samples_per_second,realtime_factor") == STATUS_OK);
+
+        for (const meta::plugin_t * const *pmeta = variants; *pmeta != NULL; ++pmeta)
+        {
+            const meta::plugin_t *meta = *pmeta;
+            if ((filter.sPlugin != NULL) && (strcmp(filter.sPlugin, meta->uid) != 0))
+                continue;
+
+            test::PluginHost host;
+            PTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+
+            printf("Benchmarking %s...\n", meta->uid);
+
+            for (size_t xover=0; xover < 2; ++xover)
+            {
+                if ((filter.nXover >= 0) && (xover != size_t(filter.nXover)))
+                    continue;
+
+                for (size_t ovs=0; ovs < OVS_MODES; ++ovs)
+                {
+                    if (!ovs_selected(&filter, ovs))
+                        continue;
+
+                    for (size_t bands=1; bands <= meta::mb_limiter::BANDS_MAX; ++bands)
+                    {
+                        if (!bands_selected(&filter, bands))
+                            continue;
+
+                        for (size_t flags=0; flags < 4; ++flags)
+                        {
+                            const bool dither   = flags & 1;
+                            const bool analyzer = flags & 2;
+
+                            configure(&host, xover, ovs, bands, dither, analyzer);
+                            run(&host, signal, WARMUP_LENGTH);
+
+                            const double start  = test::precise_time();
+                            run(&host, signal, SIGNAL_LENGTH);
+                            const double time   = lsp_max(test::precise_time() - start, 1e-9);
+
+                            const double sps    = SIGNAL_LENGTH / time;
+                            const double rt     = sps / SAMPLE_RATE;
+
+                            printf("  %-12s %-20s bands=%d dither=%d analyzer=%d: %.0f samples/s (%.1fx realtime)\n",
+                                xover_names[xover], ovs_name(meta, ovs), int(bands),
+                                int(dither), int(analyzer), sps, rt);
+                            out.write("%s,%s,%s,%d,%d,%d,%d,%.6f,%.1f,%.3f",
+                                meta->uid, xover_names[xover], ovs_name(meta, ovs), int(bands),
+                                int(dither), int(analyzer), int(SIGNAL_LENGTH), time, sps, rt);
+                        }
+                    }
+                }
+            }
+
+            PTEST_SEPARATOR;
+        }
+
+        printf("Results have been written to: %s\n", path);
+    }
+
+PTEST_END
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/plugins/mb_limiter.h>
+#include <private/test/bench.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t BUFFER_SIZE     = 0x200 * meta::mb_limiter::OVERSAMPLING_MAX;
+    static constexpr size_t ITERATIONS      = 0x4000;
+
+    static const size_t sizes[] =
+    {
+        0x200,                  // Internal buffer without oversampling
+        0x200 * 4,              // 4x oversampling
+        0x200 * 8               // 8x oversampling
+    };
+
+    // The former scalar implementation of the stereo link
+    void stereo_link_scalar(float *cl, float *cr, float link, size_t samples)
+    {
+        for (size_t i=0; i<samples; ++i)
+        {
+            float gl = cl[i];
+            float gr = cr[i];
+
+            if (gl < gr)
+                cr[i] = gr + (gl - gr) * link;
+            else
+                cl[i] = gl + (gr - gl) * link;
+        }
+    }
+}
+
+PTEST_BEGIN("mb_limiter", "stereo_link", 0, 0)
+
+    float *vGain[2];
+    float *vWork[2];
+    float *vBuf;
+
+    // Restore the gains before each call, the link is applied in place
+    double bench(bool vector, float link, size_t samples)
+    {
+        const double start  = test::precise_time();
+        for (size_t i=0; i<ITERATIONS; ++i)
+        {
+            dsp::copy(vWork[0], vGain[0], samples);
+            dsp::copy(vWork[1], vGain[1], samples);
+            if (vector)
+                plugins::mb_limiter::perform_stereo_link(vWork[0], vWork[1], vBuf, link, samples);
+            else
+                stereo_link_scalar(vWork[0], vWork[1], link, samples);
+        }
+        return lsp_max(test::precise_time() - start, 1e-9);
+    }
+
+    PTEST_MAIN
+    {
+        float *ptr[5];
+        for (size_t i=0; i<5; ++i)
+        {
+            ptr[i]      = static_cast<float *>(malloc(BUFFER_SIZE * 2 * sizeof(float)));
+            PTEST_ASSERT(ptr[i] != NULL);
+        }
+        lsp_finally {
+            for (size_t i=0; i<5; ++i)
+                free(ptr[i]);
+        };
+
+        vGain[0]    = ptr[0];
+        vGain[1]    = ptr[1];
+        vWork[0]    = ptr[2];
+        vWork[1]    = ptr[3];
+        vBuf        = ptr[4];
+
+        // Gains of both channels cross each other randomly, the worst case for branch prediction
+        test::generate_noise(vGain[0], BUFFER_SIZE, 1, 0.5f);
+        test::generate_noise(vGain[1], BUFFER_SIZE, 2, 0.5f);
+        dsp::add_k2(vGain[0], 0.5f, BUFFER_SIZE);
+        dsp::add_k2(vGain[1], 0.5f, BUFFER_SIZE);
+
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/ptest-mb_limiter-stereo_link.csv", tempdir());
+        test::ResultWriter out;
+        PTEST_ASSERT(out.open(path, "samples,link,scalar_seconds,vector_seconds,speedup") == STATUS_OK);
+
+        for (size_t i=0; i<sizeof(sizes)/sizeof(size_t); ++i)
+        {
+            const size_t samples    = sizes[i];
+            for (size_t j=0; j<=4; ++j)
+            {
+                const float link        = j * 0.25f;
+                const double scalar     = bench(false, link, samples);
+                const double vector     = bench(true, link, samples);
+
+                printf("  samples=%-5d link=%.2f: scalar=%.3f ms, vector=%.3f ms (%.2fx)\n",
+                    int(samples), link, scalar * 1e+3, vector * 1e+3, scalar / vector);
+                out.write("%d,%.2f,%.6f,%.6f,%.3f",
+                    int(samples), link, scalar, vector, scalar / vector);
+            }
+        }
+
+        printf("Results have been written to: %s\n", path);
+    }
+
+PTEST_END
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/bench.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t BLOCK_SIZE      = 1024;
+    static constexpr size_t SIGNAL_LENGTH   = SAMPLE_RATE;          // 1 second of synthetic corpus
+    static constexpr size_t WARMUP_LENGTH   = SAMPLE_RATE / 10;     // Settle delay lines
+    static constexpr size_t BUFFER_SIZE     = 0x200;                // Internal buffer of the plugin
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        NULL
+    };
+
+    typedef struct ovs_mode_t
+    {
+        size_t          mode;
+        size_t          factor;
+        const char     *name;
+    } ovs_mode_t;
+
+    static const ovs_mode_t ovs_modes[] =
+    {
+        { meta::mb_limiter::OVS_FULL_4X24BIT, 4, "4x" },
+        { meta::mb_limiter::OVS_FULL_8X24BIT, 8, "8x" }
+    };
+
+    // -1 means regular processing, 0 means automatic selection of the tile size
+    static const ssize_t tile_sizes[] = { -1, 0, 64, 128, 256, 512, 1024, 2048 };
+
+    // Estimated working set of one pass over the data: per channel the sidechain, input,
+    // two temporary buffers, output data, VCA gain of each band and of the output limiter,
+    // plus the temporary buffer for stereo linking
+    size_t working_set(size_t channels, size_t bands, size_t samples)
+    {
+        return (channels * (bands + 6) + 2) * samples * sizeof(float);
+    }
+}
+
+PTEST_BEGIN("mb_limiter", "tiled", 0, 0)
+
+    void configure(test::PluginHost *host, size_t ovs, size_t bands, ssize_t tile)
+    {
+        char id[32];
+
+        host->reset_ports();
+        host->set("g_in", GAIN_AMP_P_6_DB);     // Make the limiters actually work
+        host->set("mode", 0.0f);                // Classic crossover
+        host->set("ovs", ovs);
+        host->set_all("ife", 0.0f);
+        host->set_all("ofe", 0.0f);
+        host->set("tile", (tile >= 0) ? 1.0f : 0.0f);
+        host->set_tile_size((tile > 0) ? tile : 0);
+
+        for (size_t i=0; i<meta::mb_limiter::BANDS_MAX-1; ++i)
+        {
+            snprintf(id, sizeof(id), "se_%d", int(i + 1));
+            host->set(id, (i < (bands - 1)) ? 1.0f : 0.0f);
+        }
+    }
+
+    void run(test::PluginHost *host, const float *signal, size_t count)
+    {
+        for (size_t offset=0; offset < count; )
+        {
+            const size_t to_do  = lsp_min(count - offset, BLOCK_SIZE);
+            host->fill_inputs(&signal[offset], to_do);
+            host->process(to_do);
+            offset             += to_do;
+        }
+    }
+
+    PTEST_MAIN
+    {
+        float *signal       = static_cast<float *>(malloc(SIGNAL_LENGTH * sizeof(float)));
+        PTEST_ASSERT(signal != NULL);
+        lsp_finally { free(signal); };
+
+        test::generate_signal(test::SIG_CORPUS, signal, SIGNAL_LENGTH, SAMPLE_RATE, 0x5eed);
+
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/ptest-mb_limiter-tiled.csv", tempdir());
+        test::ResultWriter out;
+        PTEST_ASSERT(out.open(path,
+            "plugin,ovs,bands,tile,working_set,samples,seconds,samples_per_second,speedup") == STATUS_OK);
+
+        static const size_t band_counts[] = { 4, meta::mb_limiter::BANDS_MAX };
+
+        for (const meta::plugin_t * const *pmeta = variants; *pmeta != NULL; ++pmeta)
+        {
+            const meta::plugin_t *meta = *pmeta;
+            test::PluginHost host;
+            PTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+            const size_t channels   = (host.has_port("out_r")) ? 2 : 1;
+
+            printf("Benchmarking %s...\n", meta->uid);
+
+            for (size_t i=0; i<sizeof(ovs_modes)/sizeof(ovs_mode_t); ++i)
+                for (size_t j=0; j<sizeof(band_counts)/sizeof(size_t); ++j)
+                {
+                    const ovs_mode_t *ovs   = &ovs_modes[i];
+                    const size_t bands      = band_counts[j];
+                    double base_sps         = 0.0;
+
+                    for (size_t k=0; k<sizeof(tile_sizes)/sizeof(ssize_t); ++k)
+                    {
+                        const ssize_t tile  = tile_sizes[k];
+                        if (tile > ssize_t(BUFFER_SIZE * ovs->factor))
+                            continue;
+
+                        configure(&host, ovs->mode, bands, tile);
+                        run(&host, signal, WARMUP_LENGTH);
+
+                        // The whole oversampled buffer is one tile in the regular mode
+                        const size_t actual = (tile >= 0) ? host.tile_size() : BUFFER_SIZE * ovs->factor;
+                        const size_t ws     = working_set(channels, bands, actual);
+
+                        const double start  = test::precise_time();
+                        run(&host, signal, SIGNAL_LENGTH);
+                        const double time   = lsp_max(test::precise_time() - start, 1e-9);
+
+                        const double sps    = SIGNAL_LENGTH / time;
+                        if (tile < 0)
+                            base_sps            = sps;
+                        const double speedup= (base_sps > 0.0) ? sps / base_sps : 1.0;
+
+                        printf("  ovs=%s bands=%d tile=%-7s (%4d) working set %6.1f KiB: %.0f samples/s (%.2fx)\n",
+                            ovs->name, int(bands),
+                            (tile < 0) ? "off" : (tile == 0) ? "auto" : "fixed",
+                            int(actual), ws / 1024.0, sps, speedup);
+                        out.write("%s,%s,%d,%d,%d,%d,%.6f,%.1f,%.3f",
+                            meta->uid, ovs->name, int(bands), int((tile < 0) ? 0 : actual),
+                            int(ws), int(SIGNAL_LENGTH), time, sps, speedup);
+                    }
+                }
+
+            PTEST_SEPARATOR;
+        }
+
+        printf("Results have been written to: %s\n", path);
+    }
+
+PTEST_END
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t LENGTH          = SAMPLE_RATE / 2;
+    static constexpr size_t BLOCK_SIZE      = 64;           // Small blocks, the case the bank is made for
+    static constexpr size_t STREAMS         = 5;
+
+    static const size_t ovs_modes[] =
+    {
+        meta::mb_limiter::OVS_NONE,
+        meta::mb_limiter::OVS_FULL_8X24BIT
+    };
+}
+
+UTEST_BEGIN("mb_limiter", "bank")
+
+    float *vIn[STREAMS];
+    float *vBank[STREAMS];
+    float *vRef;
+
+    void configure(test::PluginHost *host, size_t xover, size_t ovs)
+    {
+        host->reset_ports();
+        host->set("mode", xover);
+        host->set("ovs", ovs);
+        host->set("g_in", 4.0f);            // +12 dB to keep limiters busy
+        host->set_all("se_", 1.0f);         // All 8 bands
+        host->update_settings();
+    }
+
+    void test_unsupported()
+    {
+        const meta::plugin_t *variants[] =
+        {
+            &meta::mb_limiter_stereo,
+            &meta::sc_mb_limiter_mono,
+            &meta::sc_mb_limiter_stereo
+        };
+
+        for (size_t i=0; i<sizeof(variants)/sizeof(variants[0]); ++i)
+        {
+            test::PluginHost host;
+            UTEST_ASSERT(host.init(variants[i], SAMPLE_RATE, BLOCK_SIZE, STREAMS) == STATUS_OK);
+            UTEST_ASSERT_MSG(host.streams() == 0, "%s should not support the bank of streams", variants[i]->uid);
+        }
+    }
+
+    void test_bank(size_t xover, size_t ovs)
+    {
+        printf("Testing bank of %d streams xover=%d ovs=%d...\n", int(STREAMS), int(xover), int(ovs));
+
+        // Render all streams with the bank
+        test::PluginHost bank;
+        UTEST_ASSERT(bank.init(&meta::mb_limiter_mono, SAMPLE_RATE, BLOCK_SIZE, STREAMS) == STATUS_OK);
+        UTEST_ASSERT(bank.streams() == STREAMS);
+        configure(&bank, xover, ovs);
+
+        const float *in[STREAMS];
+        float *out[STREAMS];
+        for (size_t offset=0; offset < LENGTH; )
+        {
+            const size_t to_do  = lsp_min(LENGTH - offset, BLOCK_SIZE);
+            for (size_t i=0; i<STREAMS; ++i)
+            {
+                in[i]       = &vIn[i][offset];
+                out[i]      = &vBank[i][offset];
+            }
+            bank.process_bank(in, out, to_do);
+            offset             += to_do;
+        }
+
+        // Each stream should match the separate instance of the plugin. The linear-phase
+        // crossover processes FFT frames of streams at different positions which changes
+        // the rounding but not the result
+        const float tolerance   = (xover > 0) ? 1e-4f : 0.0f;
+        for (size_t i=0; i<STREAMS; ++i)
+        {
+            test::PluginHost host;
+            UTEST_ASSERT(host.init(&meta::mb_limiter_mono, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+            configure(&host, xover, ovs);
+            UTEST_ASSERT(host.latency() == bank.latency());
+
+            float *hin      = host.buffer("in");
+            const float *hout = host.buffer("out");
+            UTEST_ASSERT((hin != NULL) && (hout != NULL));
+
+            for (size_t offset=0; offset < LENGTH; )
+            {
+                const size_t to_do  = lsp_min(LENGTH - offset, BLOCK_SIZE);
+                dsp::copy(hin, &vIn[i][offset], to_do);
+                host.process(to_do);
+                dsp::copy(&vRef[offset], hout, to_do);
+                offset             += to_do;
+            }
+
+            for (size_t j=0; j<LENGTH; ++j)
+            {
+                UTEST_ASSERT_MSG(fabsf(vRef[j] - vBank[i][j]) <= tolerance,
+                    "Output mismatch at stream %d sample %d: instance=%f, bank=%f",
+                    int(i), int(j), vRef[j], vBank[i][j]);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        float *ptr[STREAMS*2 + 1];
+        for (size_t i=0; i<STREAMS*2 + 1; ++i)
+        {
+            ptr[i]      = static_cast<float *>(malloc(LENGTH * sizeof(float)));
+            UTEST_ASSERT(ptr[i] != NULL);
+        }
+        lsp_finally {
+            for (size_t i=0; i<STREAMS*2 + 1; ++i)
+                free(ptr[i]);
+        };
+
+        // Each stream gets its own material
+        for (size_t i=0; i<STREAMS; ++i)
+        {
+            vIn[i]      = ptr[i];
+            vBank[i]    = ptr[STREAMS + i];
+            if (i & 1)
+                test::generate_transients(vIn[i], LENGTH, SAMPLE_RATE, i + 1, 1.0f);
+            else
+                test::generate_noise(vIn[i], LENGTH, i + 1, 0.5f);
+        }
+        vRef        = ptr[STREAMS*2];
+
+        test_unsupported();
+
+        for (size_t xover=0; xover < 2; ++xover)
+            for (size_t i=0; i<sizeof(ovs_modes)/sizeof(size_t); ++i)
+                test_bank(xover, ovs_modes[i]);
+    }
+
+UTEST_END
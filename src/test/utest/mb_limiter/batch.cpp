@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+ */
+
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/test/batch.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t LENGTH          = SAMPLE_RATE * 2;
+    static constexpr size_t BLOCK_SIZE      = 0x400;
+    static constexpr size_t FILES           = 3;
+    static constexpr float  MAX_DEVIATION   = 1e-4f;        // -80 dB
+}
+
+UTEST_BEGIN("mb_limiter", "batch")
+
+    void make_path(char *dst, size_t size, const char *kind, size_t index)
+    {
+        snprintf(dst, size, "%s/utest-%s-%s-%d.wav", tempdir(), full_name(), kind, int(index));
+    }
+
+    UTEST_MAIN
+    {
+        char src[1024], dst[1024];
+        test::BatchRenderer batch;
+
+        // All files have the same configuration, so the single worker should reuse the instance
+        for (size_t i=0; i<FILES; ++i)
+        {
+            dspu::Sample s;
+            UTEST_ASSERT(s.init(1, LENGTH, LENGTH));
+            s.set_sample_rate(SAMPLE_RATE);
+            test::generate_signal(test::SIG_CORPUS, s.channel(0), LENGTH, SAMPLE_RATE, i + 1);
+
+            make_path(src, sizeof(src), "in", i);
+            make_path(dst, sizeof(dst), "out", i);
+            UTEST_ASSERT(s.save(src) >= 0);
+            UTEST_ASSERT(batch.add(src, NULL, dst) == STATUS_OK);
+        }
+
+        test::batch_stats_t stats;
+        UTEST_ASSERT(batch.run(1, BLOCK_SIZE, &stats) == STATUS_OK);
+        printf("Instances created: %d, reused: %d, stolen: %d\n",
+            int(stats.instances), int(stats.reused), int(stats.stolen));
+        UTEST_ASSERT(stats.failed == 0);
+        UTEST_ASSERT(stats.instances == 1);
+        UTEST_ASSERT(stats.reused == FILES - 1);
+
+        // The output of the reused instance should match the output of the fresh instance
+        for (size_t i=0; i<FILES; ++i)
+        {
+            const test::batch_job_t *job = batch.job(i);
+            UTEST_ASSERT(job->status == STATUS_OK);
+            UTEST_ASSERT(job->stats.frames == LENGTH);
+
+            dspu::Sample in, out, ref;
+            UTEST_ASSERT(in.load(job->src) == STATUS_OK);
+            UTEST_ASSERT(out.load(job->dst) == STATUS_OK);
+            UTEST_ASSERT(out.length() == LENGTH);
+            UTEST_ASSERT(test::render_sample(&ref, &in, NULL, BLOCK_SIZE, NULL) == STATUS_OK);
+
+            const float *a  = out.channel(0);
+            const float *b  = ref.channel(0);
+            float deviation = 0.0f;
+            for (size_t j=0; j<LENGTH; ++j)
+                deviation       = lsp_max(deviation, fabsf(a[j] - b[j]));
+
+            printf("Job %d (%s instance): max deviation %g\n", int(i), (job->reused) ? "reused" : "new", deviation);
+            UTEST_ASSERT_MSG(deviation <= MAX_DEVIATION,
+                "Output of job %d deviates from the fresh instance: %g", int(i), deviation);
+        }
+    }
+
+UTEST_END
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+ */
+
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/test/render.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t LENGTH          = SAMPLE_RATE * 4;
+    static constexpr size_t BLOCK_SIZE      = 480;
+    static constexpr size_t CHUNKS          = 4;
+    static constexpr float  MAX_DEVIATION   = 1e-4f;        // -80 dB
+}
+
+UTEST_BEGIN("mb_limiter", "chunked_render")
+
+    void test_channels(size_t channels)
+    {
+        printf("Testing chunked render of %d channel(s)...\n", int(channels));
+
+        dspu::Sample src, dst;
+        UTEST_ASSERT(src.init(channels, LENGTH, LENGTH));
+        src.set_sample_rate(SAMPLE_RATE);
+        test::generate_signal(test::SIG_CORPUS, src.channel(0), LENGTH, SAMPLE_RATE, 1);
+        if (channels > 1)
+            test::generate_transients(src.channel(1), LENGTH, SAMPLE_RATE, 2, 1.0f);
+
+        test::chunk_params_t params;
+        params.block_size   = BLOCK_SIZE;
+        params.chunks       = CHUNKS;
+        params.preroll      = -1;
+        params.verify       = true;
+
+        test::chunk_stats_t stats;
+        UTEST_ASSERT(test::render_sample_chunked(&dst, &src, NULL, &params, &stats) == STATUS_OK);
+        UTEST_ASSERT(dst.channels() == channels);
+        UTEST_ASSERT(dst.length() == LENGTH);
+        UTEST_ASSERT(stats.chunks == CHUNKS);
+        UTEST_ASSERT(stats.preroll >= stats.render.latency);
+        UTEST_ASSERT((stats.preroll % BLOCK_SIZE) == 0);
+
+        printf("  pre-roll %d samples, seam deviation %.2f dB at frame %d, max deviation %.2f dB\n",
+            int(stats.preroll),
+            dspu::gain_to_db(lsp_max(stats.seam_deviation, 1e-20f)), int(stats.seam_position),
+            dspu::gain_to_db(lsp_max(stats.max_deviation, 1e-20f)));
+
+        // After the pre-roll the state of each instance should match the serial render
+        UTEST_ASSERT_MSG(stats.max_deviation <= MAX_DEVIATION,
+            "Chunked render deviates from the serial render: %g at frame %d",
+            stats.seam_deviation, int(stats.seam_position));
+    }
+
+    UTEST_MAIN
+    {
+        test_channels(1);
+        test_channels(2);
+    }
+
+UTEST_END
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t LENGTH          = SAMPLE_RATE;
+    static constexpr size_t SETTLE          = SAMPLE_RATE / 10;     // Skip latency and filter settling
+    static constexpr size_t BLOCK_SIZE      = 480;
+    static constexpr float  MAX_DEVIATION   = 0.1f;                 // dB
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        NULL
+    };
+
+    static const char *in_ports[]   = { "in_l", "in_r", "in" };
+    static const char *out_ports[]  = { "out_l", "out_r", "out" };
+}
+
+UTEST_BEGIN("mb_limiter", "crossover")
+
+    float *vIn;
+    float *vOut;
+
+    void configure(test::PluginHost *host, size_t bands)
+    {
+        char id[32];
+
+        // Bypass all limiters, so the output is the sum of bands of the crossover
+        host->reset_ports();
+        host->set("mode", 0.0f);            // Classic crossover
+        host->set_all("on", 0.0f);
+        host->set_all("gb", 0.0f);
+
+        for (size_t i=0; i<meta::mb_limiter::BANDS_MAX-1; ++i)
+        {
+            snprintf(id, sizeof(id), "se_%d", int(i + 1));
+            host->set(id, (i < (bands - 1)) ? 1.0f : 0.0f);
+        }
+    }
+
+    void test_variant(const meta::plugin_t *meta, size_t bands)
+    {
+        printf("Testing %s bands=%d...\n", meta->uid, int(bands));
+
+        test::PluginHost host;
+        UTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+        const size_t channels       = (host.has_port("out_r")) ? 2 : 1;
+        const char * const *in_id   = (channels > 1) ? &in_ports[0] : &in_ports[2];
+        const char * const *out_id  = (channels > 1) ? &out_ports[0] : &out_ports[2];
+        configure(&host, bands);
+
+        float *in[2];
+        const float *outp[2];
+        for (size_t ch=0; ch<channels; ++ch)
+        {
+            in[ch]      = host.buffer(in_id[ch]);
+            outp[ch]    = host.buffer(out_id[ch]);
+            UTEST_ASSERT((in[ch] != NULL) && (outp[ch] != NULL));
+        }
+
+        for (size_t offset=0; offset < LENGTH; )
+        {
+            const size_t to_do  = lsp_min(LENGTH - offset, BLOCK_SIZE);
+            for (size_t ch=0; ch<channels; ++ch)
+                dsp::copy(in[ch], &vIn[offset], to_do);
+            host.process(to_do);
+            dsp::copy(&vOut[offset], outp[channels - 1], to_do);
+            offset             += to_do;
+        }
+
+        // Linkwitz-Riley bands sum to the all-pass response, so the power of white noise
+        // should be preserved for any number of bands
+        const size_t latency= host.latency();
+        UTEST_ASSERT(latency < SETTLE);
+        const size_t count  = LENGTH - SETTLE - latency;
+        const float in_rms  = sqrtf(dsp::h_sqr_sum(&vIn[SETTLE], count) / count);
+        const float out_rms = sqrtf(dsp::h_sqr_sum(&vOut[SETTLE + latency], count) / count);
+        const float dev     = dspu::gain_to_db(out_rms / in_rms);
+
+        printf("  deviation of power: %.3f dB\n", dev);
+        UTEST_ASSERT_MSG(fabsf(dev) <= MAX_DEVIATION,
+            "Crossover of %s with %d bands changes power by %.3f dB", meta->uid, int(bands), dev);
+    }
+
+    UTEST_MAIN
+    {
+        vIn         = static_cast<float *>(malloc(LENGTH * sizeof(float)));
+        vOut        = static_cast<float *>(malloc(LENGTH * sizeof(float)));
+        UTEST_ASSERT((vIn != NULL) && (vOut != NULL));
+        lsp_finally {
+            free(vIn);
+            free(vOut);
+        };
+
+        test::generate_noise(vIn, LENGTH, 1, 0.25f);
+
+        for (const meta::plugin_t * const *meta = variants; *meta != NULL; ++meta)
+            for (size_t bands=1; bands <= meta::mb_limiter::BANDS_MAX; ++bands)
+                test_variant(*meta, bands);
+    }
+
+UTEST_END
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t LENGTH          = SAMPLE_RATE / 2;
+    static constexpr size_t BLOCK_SIZE      = 4096;         // Large host blocks
+
+    typedef struct event_t
+    {
+        size_t      position;
+        const char *id;
+        float       value;
+    } event_t;
+
+    // Changes applied inside of the block
+    static const event_t events[] =
+    {
+        { 1001,     "th",       0.25f   },
+        { 3333,     "bmk_2",    2.0f    },
+        { 4096,     "g_in",     8.0f    },
+        { 7000,     "th_1",     0.125f  },
+        { 7001,     "at",       1.0f    },
+        { 9500,     "bpa_3",    1.5f    },
+        { 15000,    "g_out",    0.5f    },
+        { 15000,    "rt_2",     100.0f  },
+    };
+
+    static constexpr size_t EVENTS          = sizeof(events) / sizeof(event_t);
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        NULL
+    };
+
+    static const char *in_ports[]   = { "in_l", "in_r", "in" };
+    static const char *out_ports[]  = { "out_l", "out_r", "out" };
+}
+
+UTEST_BEGIN("mb_limiter", "events")
+
+    float *vIn;
+    float *vOut[3];
+
+    void configure(test::PluginHost *host, bool pipeline)
+    {
+        host->reset_ports();
+        host->set("g_in", 4.0f);            // +12 dB to keep limiters busy
+        host->set_all("se_", 1.0f);         // All 8 bands
+        host->set("pipe", (pipeline) ? 1.0f : 0.0f);
+        host->update_settings();
+        host->update_resources();           // Threads are started on the first use
+        host->update_settings();
+    }
+
+    // Render the signal, the host splits blocks at positions of changes if events are not used
+    void render(test::PluginHost *host, float *out, size_t channels, bool use_events, size_t num_events)
+    {
+        const char * const *in_id   = (channels > 1) ? &in_ports[0] : &in_ports[2];
+        const char * const *out_id  = (channels > 1) ? &out_ports[0] : &out_ports[2];
+        float *in[2];
+        const float *outp;
+
+        for (size_t ch=0; ch<channels; ++ch)
+        {
+            in[ch]      = host->buffer(in_id[ch]);
+            UTEST_ASSERT(in[ch] != NULL);
+        }
+        outp        = host->buffer(out_id[0]);
+        UTEST_ASSERT(outp != NULL);
+
+        // All changes are posted in advance
+        if (use_events)
+        {
+            for (size_t i=0; i<num_events; ++i)
+                UTEST_ASSERT(host->post(events[i].id, events[i].value, events[i].position));
+        }
+
+        size_t event = 0;
+        for (size_t offset=0; offset < LENGTH; )
+        {
+            size_t to_do        = lsp_min(LENGTH - offset, BLOCK_SIZE - (offset % BLOCK_SIZE));
+            if (!use_events)
+            {
+                for ( ; (event < num_events) && (events[event].position <= offset); ++event)
+                {
+                    UTEST_ASSERT(host->set(events[event].id, events[event].value));
+                    host->update_settings();
+                }
+                if (event < num_events)
+                    to_do               = lsp_min(to_do, events[event].position - offset);
+            }
+
+            for (size_t ch=0; ch<channels; ++ch)
+                dsp::copy(in[ch], &vIn[offset], to_do);
+            host->process(to_do);
+            dsp::copy(&out[offset], outp, to_do);
+            offset             += to_do;
+        }
+    }
+
+    void test_variant(const meta::plugin_t *meta, bool pipeline)
+    {
+        char name[256];
+        snprintf(name, sizeof(name), "%s pipe=%d", meta->uid, int(pipeline));
+        printf("Testing %s...\n", name);
+
+        const size_t channels   = (meta == &meta::mb_limiter_stereo) ? 2 : 1;
+        for (size_t i=0; i<3; ++i)
+        {
+            test::PluginHost host;
+            UTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+            configure(&host, pipeline);
+
+            // Reference without changes, changes applied by host, changes posted to the queue
+            render(&host, vOut[i], channels, i == 2, (i > 0) ? EVENTS : 0);
+
+            // Parameters that require the full update of settings can not be posted
+            UTEST_ASSERT(!host.post("bm_3", 1.0f, 0));
+        }
+
+        // Changes take effect exactly at their positions
+        for (size_t i=0; i<LENGTH; ++i)
+        {
+            UTEST_ASSERT_MSG(vOut[1][i] == vOut[2][i],
+                "Output mismatch for %s at sample %d: host=%f, events=%f",
+                name, int(i), vOut[1][i], vOut[2][i]);
+        }
+
+        // The output is not affected before the first change
+        for (size_t i=0; i<events[0].position; ++i)
+        {
+            UTEST_ASSERT_MSG(vOut[0][i] == vOut[2][i],
+                "Output of %s has been changed before the first event at sample %d", name, int(i));
+        }
+        UTEST_ASSERT_MSG(dsp::abs_max(vOut[0], LENGTH) != dsp::abs_max(vOut[2], LENGTH),
+            "Events have not been applied for %s", name);
+    }
+
+    UTEST_MAIN
+    {
+        float *ptr[4];
+        for (size_t i=0; i<4; ++i)
+        {
+            ptr[i]      = static_cast<float *>(malloc(LENGTH * sizeof(float)));
+            UTEST_ASSERT(ptr[i] != NULL);
+        }
+        lsp_finally {
+            for (size_t i=0; i<4; ++i)
+                free(ptr[i]);
+        };
+
+        vIn         = ptr[0];
+        vOut[0]     = ptr[1];
+        vOut[1]     = ptr[2];
+        vOut[2]     = ptr[3];
+
+        test::generate_signal(test::SIG_CORPUS, vIn, LENGTH, SAMPLE_RATE, 1);
+
+        // In pipelined mode changes should not affect the buffer that is still in the pipeline
+        for (const meta::plugin_t * const *meta = variants; *meta != NULL; ++meta)
+        {
+            test_variant(*meta, false);
+            test_variant(*meta, true);
+        }
+    }
+
+UTEST_END
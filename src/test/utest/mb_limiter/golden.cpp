@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t BLOCK_SIZE      = 512;
+    static constexpr size_t SIGNAL_LENGTH   = SAMPLE_RATE * 2;
+    static constexpr uint32_t GOLDEN_MAGIC  = 0x474c424d;   // 'MBLG'
+    static constexpr uint32_t GOLDEN_VERSION= 1;
+
+    // Environment variable that turns the test into the generator of reference renders
+    static const char *GOLDEN_UPDATE_ENV    = "LSP_MB_LIMITER_GOLDEN_UPDATE";
+
+    // Tolerances: IIR crossover is computed sample-by-sample and should match almost exactly,
+    // the FFT crossover and oversamplers accumulate more rounding differences between CPU paths
+    static constexpr float TOL_CLASSIC      = 1e-5f;
+    static constexpr float TOL_LINEAR_PHASE = 1e-4f;
+    static constexpr float TOL_OVERSAMPLING = 1e-4f;
+
+    typedef struct golden_header_t
+    {
+        uint32_t    magic;
+        uint32_t    version;
+        uint32_t    sample_rate;
+        uint32_t    channels;
+        uint32_t    frames;
+        int32_t     latency;
+    } golden_header_t;
+
+    typedef struct param_t
+    {
+        const char *id;         // Port identifier or prefix of identifiers
+        float       value;      // Value to set
+    } param_t;
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        &meta::sc_mb_limiter_mono,
+        &meta::sc_mb_limiter_stereo,
+        NULL
+    };
+
+    static const char *premix_ports[] =
+    {
+        "in2lk",
+        "lk2in",
+        "lk2sc",
+        "in2sc",
+        "sc2in",
+        "sc2lk",
+        NULL
+    };
+
+    static const char *output_ports[] =
+    {
+        "out",
+        "out_l",
+        "out_r",
+        NULL
+    };
+
+    static bool has_port(const meta::plugin_t *meta, const char *id)
+    {
+        for (const meta::port_t *p = meta->ports; (p != NULL) && (p->id != NULL); ++p)
+            if (!strcmp(p->id, id))
+                return true;
+        return false;
+    }
+}
+
+UTEST_BEGIN("mb_limiter", "golden")
+
+    size_t nUpdated;
+    size_t nPassed;
+    bool bUpdate;
+
+    void prepare_input(test::PluginHost *host, const float *main, const float *sc, size_t offset, size_t count)
+    {
+        host->fill_inputs(&main[offset], count);
+
+        // Make the right channel different from the left one
+        float *buf  = host->buffer("in_r");
+        if (buf != NULL)
+            dsp::mul_k3(buf, &main[offset], -0.5f, count);
+
+        // Make the sidechain different from the input
+        static const char *sc_ports[] = { "sc", "sc_l", "sc_r", NULL };
+        for (const char * const *id = sc_ports; *id != NULL; ++id)
+        {
+            if ((buf = host->buffer(*id)) != NULL)
+                dsp::copy(buf, &sc[offset], count);
+        }
+    }
+
+    void render(test::PluginHost *host, const float *main, const float *sc, float *dst)
+    {
+        for (size_t offset=0; offset < SIGNAL_LENGTH; )
+        {
+            const size_t to_do  = lsp_min(SIGNAL_LENGTH - offset, BLOCK_SIZE);
+            prepare_input(host, main, sc, offset, to_do);
+            host->process(to_do);
+
+            size_t ch = 0;
+            for (const char * const *id = output_ports; *id != NULL; ++id)
+            {
+                const float *out = host->buffer(*id);
+                if (out == NULL)
+                    continue;
+                dsp::copy(&dst[ch * SIGNAL_LENGTH + offset], out, to_do);
+                ++ch;
+            }
+
+            offset             += to_do;
+        }
+    }
+
+    bool save_golden(const char *path, const golden_header_t *hdr, const float *data)
+    {
+        FILE *fd = fopen(path, "wb");
+        if (fd == NULL)
+            return false;
+        lsp_finally { fclose(fd); };
+
+        if (fwrite(hdr, sizeof(golden_header_t), 1, fd) != 1)
+            return false;
+        const size_t count = hdr->channels * hdr->frames;
+        return fwrite(data, sizeof(float), count, fd) == count;
+    }
+
+    float *load_golden(const char *path, golden_header_t *hdr)
+    {
+        FILE *fd = fopen(path, "rb");
+        if (fd == NULL)
+            return NULL;
+        lsp_finally { fclose(fd); };
+
+        if (fread(hdr, sizeof(golden_header_t), 1, fd) != 1)
+            return NULL;
+        if ((hdr->magic != GOLDEN_MAGIC) || (hdr->version != GOLDEN_VERSION))
+            return NULL;
+
+        const size_t count  = hdr->channels * hdr->frames;
+        float *data         = static_cast<float *>(malloc(count * sizeof(float)));
+        if (data == NULL)
+            return NULL;
+        if (fread(data, sizeof(float), count, fd) != count)
+        {
+            free(data);
+            return NULL;
+        }
+
+        return data;
+    }
+
+    void run_case(const meta::plugin_t *meta, const char *scenario,
+        const param_t *params, size_t nparams, float tolerance,
+        const float *main, const float *sc)
+    {
+        char name[256], ref_path[1024], out_path[1024];
+        snprintf(name, sizeof(name), "%s-%s", meta->uid, scenario);
+        printf("Testing '%s'...\n", name);
+
+        // Instantiate and configure the plugin
+        test::PluginHost host;
+        UTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+        host.set("g_in", GAIN_AMP_P_6_DB);      // Engage the limiters
+        for (size_t i=0; i<nparams; ++i)
+            UTEST_ASSERT_MSG(host.set_all(params[i].id, params[i].value) > 0,
+                "Missing port '%s' for case '%s'", params[i].id, name);
+
+        // Render the output
+        const size_t channels   = (has_port(meta, "out_l")) ? 2 : 1;
+        float *data             = static_cast<float *>(malloc(channels * SIGNAL_LENGTH * sizeof(float)));
+        UTEST_ASSERT(data != NULL);
+        lsp_finally { free(data); };
+        render(&host, main, sc, data);
+
+        golden_header_t hdr;
+        hdr.magic               = GOLDEN_MAGIC;
+        hdr.version             = GOLDEN_VERSION;
+        hdr.sample_rate         = SAMPLE_RATE;
+        hdr.channels            = channels;
+        hdr.frames              = SIGNAL_LENGTH;
+        hdr.latency             = host.latency();
+
+        // Regenerate the reference render if explicitly requested
+        snprintf(ref_path, sizeof(ref_path), "%s/mb_limiter/golden/%s.bin", resources(), name);
+        if (bUpdate)
+        {
+            UTEST_ASSERT_MSG(save_golden(ref_path, &hdr, data),
+                "Could not write reference %s", ref_path);
+            printf("  reference %s has been updated\n", ref_path);
+            ++nUpdated;
+            return;
+        }
+
+        // Load the reference render, the missing reference is a failure. The current render
+        // is stored to the temporary directory to simplify the investigation
+        golden_header_t ref_hdr;
+        out_path[0]             = '\0';
+        float *ref              = load_golden(ref_path, &ref_hdr);
+        if (ref == NULL)
+        {
+            snprintf(out_path, sizeof(out_path), "%s/utest-mb_limiter-golden-%s.bin", tempdir(), name);
+            save_golden(out_path, &hdr, data);
+        }
+        UTEST_ASSERT_MSG(ref != NULL,
+            "Missing or invalid reference %s for case '%s', current render saved to %s. "
+            "References are generated by running the test with %s=1, see res/test/mb_limiter/golden/README.md",
+            ref_path, name, out_path, GOLDEN_UPDATE_ENV);
+        lsp_finally { free(ref); };
+
+        // Compare with the reference
+        UTEST_ASSERT_MSG((ref_hdr.sample_rate == hdr.sample_rate) &&
+                         (ref_hdr.channels == hdr.channels) &&
+                         (ref_hdr.frames == hdr.frames),
+            "Reference format mismatch for case '%s'", name);
+        UTEST_ASSERT_MSG(ref_hdr.latency == hdr.latency,
+            "Latency mismatch for case '%s': reported=%d, reference=%d",
+            name, int(hdr.latency), int(ref_hdr.latency));
+
+        for (size_t i=0, n=channels * SIGNAL_LENGTH; i<n; ++i)
+        {
+            const float diff = fabsf(data[i] - ref[i]);
+            UTEST_ASSERT_MSG(diff <= tolerance,
+                "Output mismatch for case '%s' at channel %d sample %d: got %.8f, expected %.8f, tolerance %g",
+                name, int(i / SIGNAL_LENGTH), int(i % SIGNAL_LENGTH), data[i], ref[i], tolerance);
+        }
+
+        ++nPassed;
+    }
+
+    void run_variant(const meta::plugin_t *meta, const float *main, const float *sc)
+    {
+        char scenario[64];
+        param_t params[4];
+
+        // Crossover modes
+        params[0]   = { "mode", 0.0f };
+        run_case(meta, "classic", params, 1, TOL_CLASSIC, main, sc);
+        params[0]   = { "mode", 1.0f };
+        run_case(meta, "linear_phase", params, 1, TOL_LINEAR_PHASE, main, sc);
+
+        // Limiter modes, 'lm' prefix covers main and band limiters
+        for (size_t lm=0; lm <= meta::mb_limiter::LOM_LINE_DUCK; ++lm)
+        {
+            snprintf(scenario, sizeof(scenario), "limiter_mode_%d", int(lm));
+            params[0]   = { "lm", float(lm) };
+            run_case(meta, scenario, params, 1, TOL_CLASSIC, main, sc);
+        }
+
+        // True peak oversampling
+        params[0]   = { "ovs", float(meta::mb_limiter::OVS_TRUE_PEAK_16BIT) };
+        run_case(meta, "true_peak_16bit", params, 1, TOL_OVERSAMPLING, main, sc);
+        params[0]   = { "ovs", float(meta::mb_limiter::OVS_TRUE_PEAK_24BIT) };
+        run_case(meta, "true_peak_24bit", params, 1, TOL_OVERSAMPLING, main, sc);
+        params[1]   = { "mode", 1.0f };
+        run_case(meta, "true_peak_24bit_linear_phase", params, 2, TOL_OVERSAMPLING, main, sc);
+
+        // Sidechain modes: internal, external (sidechain versions only), link
+        const size_t sc_modes   = (has_port(meta, "sc") || has_port(meta, "sc_l")) ? 3 : 2;
+        for (size_t i=0; i<sc_modes; ++i)
+        {
+            snprintf(scenario, sizeof(scenario), "sidechain_%d", int(i));
+            params[0]   = { "extsc", float(i) };
+            run_case(meta, scenario, params, 1, TOL_CLASSIC, main, sc);
+        }
+
+        // Premix routes
+        for (const char * const *id = premix_ports; *id != NULL; ++id)
+        {
+            if (!has_port(meta, *id))
+                continue;
+            snprintf(scenario, sizeof(scenario), "premix_%s", *id);
+            params[0]   = { *id, GAIN_AMP_0_DB };
+            run_case(meta, scenario, params, 1, TOL_CLASSIC, main, sc);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        nUpdated    = 0;
+        nPassed     = 0;
+
+        const char *update = getenv(GOLDEN_UPDATE_ENV);
+        bUpdate     = (update != NULL) && (!strcmp(update, "1"));
+
+        // Fixed input material: noise + sweep + transients for input, transients for sidechain
+        float *main = static_cast<float *>(malloc(SIGNAL_LENGTH * sizeof(float)));
+        float *sc   = static_cast<float *>(malloc(SIGNAL_LENGTH * sizeof(float)));
+        UTEST_ASSERT((main != NULL) && (sc != NULL));
+        lsp_finally {
+            free(main);
+            free(sc);
+        };
+        test::generate_signal(test::SIG_CORPUS, main, SIGNAL_LENGTH, SAMPLE_RATE, 0x1234);
+        test::generate_signal(test::SIG_TRANSIENTS, sc, SIGNAL_LENGTH, SAMPLE_RATE, 0x4321);
+
+        for (const meta::plugin_t * const *meta = variants; *meta != NULL; ++meta)
+            run_variant(*meta, main, sc);
+
+        printf("Passed: %d, updated references: %d\n", int(nPassed), int(nUpdated));
+    }
+
+UTEST_END
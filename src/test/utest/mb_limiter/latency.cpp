@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/PluginHost.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t BLOCK_SIZE      = 512;
+    static constexpr size_t TAIL_LENGTH     = 0x2000;       // Samples rendered after the expected impulse position
+    static constexpr float IMPULSE_LEVEL    = 0.25f;        // Well below the threshold, limiters stay idle
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        &meta::sc_mb_limiter_mono,
+        &meta::sc_mb_limiter_stereo,
+        NULL
+    };
+
+    static const size_t sample_rates[] = { 44100, 48000, 96000, 192000 };
+
+    static const float lookahead[] =
+    {
+        meta::mb_limiter::LOOKAHEAD_MIN,
+        1.0f,
+        meta::mb_limiter::LOOKAHEAD_DFL,
+        10.0f,
+        meta::mb_limiter::LOOKAHEAD_MAX
+    };
+
+    static const char *output_ports[] = { "out", "out_l", "out_r", NULL };
+}
+
+UTEST_BEGIN("mb_limiter", "latency")
+
+    float *vImpulse;
+    float *vZero;
+    float *vOut[2];
+    size_t nMaxLength;
+
+    void feed_zeros(test::PluginHost *host, size_t count)
+    {
+        for (size_t offset=0; offset < count; )
+        {
+            const size_t to_do  = lsp_min(count - offset, BLOCK_SIZE);
+            host->fill_inputs(vZero, to_do);
+            host->process(to_do);
+            offset             += to_do;
+        }
+    }
+
+    // Feed the impulse and collect the response of all output channels
+    size_t render_impulse(test::PluginHost *host, size_t count)
+    {
+        dsp::fill_zero(vImpulse, BLOCK_SIZE);
+        vImpulse[0]         = IMPULSE_LEVEL;
+
+        for (size_t offset=0; offset < count; )
+        {
+            const size_t to_do  = lsp_min(count - offset, BLOCK_SIZE);
+            host->fill_inputs((offset == 0) ? vImpulse : vZero, to_do);
+            host->process(to_do);
+
+            size_t ch = 0;
+            for (const char * const *id = output_ports; *id != NULL; ++id)
+            {
+                const float *buf    = host->buffer(*id);
+                if (buf != NULL)
+                    dsp::copy(&vOut[ch++][offset], buf, to_do);
+            }
+            offset             += to_do;
+        }
+
+        return count;
+    }
+
+    void check_case(test::PluginHost *host, const char *name, ssize_t tolerance, bool exact_gain)
+    {
+        // Let the previous configuration fully settle, including the bypass cross-fade
+        host->update_settings();
+
+        const ssize_t latency   = host->latency();
+        const size_t count      = latency + TAIL_LENGTH;
+        const size_t channels   = (host->has_port("out_l")) ? 2 : 1;
+        UTEST_ASSERT_MSG(count <= nMaxLength,
+            "Too large latency for %s: %d", name, int(latency));
+
+        feed_zeros(host, count);
+        UTEST_ASSERT_MSG(host->latency() == latency,
+            "Latency changed without settings change for %s", name);
+
+        render_impulse(host, count);
+
+        for (size_t ch=0; ch<channels; ++ch)
+        {
+            const ssize_t peak      = dsp::abs_max_index(vOut[ch], count);
+            const float level       = vOut[ch][peak];
+            UTEST_ASSERT_MSG(fabsf(level) > IMPULSE_LEVEL * 0.1f,
+                "No impulse at the output of channel %d for %s", int(ch), name);
+            UTEST_ASSERT_MSG((peak >= latency - tolerance) && (peak <= latency + tolerance),
+                "Latency mismatch at channel %d for %s: reported=%d, measured=%d",
+                int(ch), name, int(latency), int(peak));
+            if (exact_gain)
+                UTEST_ASSERT_MSG(fabsf(level - IMPULSE_LEVEL) <= 1e-5f,
+                    "Impulse level mismatch at channel %d for %s: expected=%f, actual=%f",
+                    int(ch), name, IMPULSE_LEVEL, level);
+        }
+    }
+
+    void test_variant(const meta::plugin_t *meta, size_t sample_rate)
+    {
+        char name[256];
+        test::PluginHost host;
+        UTEST_ASSERT(host.init(meta, sample_rate, BLOCK_SIZE) == STATUS_OK);
+
+        for (size_t xover=0; xover < 2; ++xover)
+        {
+            // The classic crossover is not a pure delay when the signal is split into
+            // several bands, so it is checked with a single band only. The linear-phase
+            // crossover is checked with the default set of bands.
+            host.reset_ports();
+            host.set("mode", xover);
+            if (xover == 0)
+                host.set_all("se_", 0.0f);
+
+            for (size_t ovs=0; ovs <= meta::mb_limiter::OVS_TRUE_PEAK_24BIT; ++ovs)
+            {
+                // Oversampled signal is decimated, the filter peak may lie between the samples
+                const ssize_t tolerance = (ovs == meta::mb_limiter::OVS_NONE) ? 0 : 1;
+                host.set("ovs", ovs);
+
+                for (size_t i=0; i<sizeof(lookahead)/sizeof(float); ++i)
+                {
+                    host.set("lk", lookahead[i]);
+                    host.set("bypass", 0.0f);
+                    snprintf(name, sizeof(name), "%s sr=%d xover=%d ovs=%d lk=%.1f",
+                        meta->uid, int(sample_rate), int(xover), int(ovs), lookahead[i]);
+                    check_case(&host, name, tolerance, false);
+
+                    // The dry path in bypass mode should be sample-aligned with the processed signal
+                    host.set("bypass", 1.0f);
+                    snprintf(name, sizeof(name), "%s sr=%d xover=%d ovs=%d lk=%.1f bypass",
+                        meta->uid, int(sample_rate), int(xover), int(ovs), lookahead[i]);
+                    check_case(&host, name, 0, true);
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Maximum lookahead at maximum sample rate plus FFT crossover and oversampler latency
+        const size_t max_len    = meta::mb_limiter::LOOKAHEAD_MAX * 2 * 192 + 0x10000 + TAIL_LENGTH;
+        nMaxLength  = max_len;
+
+        vImpulse    = static_cast<float *>(malloc(BLOCK_SIZE * sizeof(float)));
+        vZero       = static_cast<float *>(malloc(BLOCK_SIZE * sizeof(float)));
+        vOut[0]     = static_cast<float *>(malloc(max_len * sizeof(float)));
+        vOut[1]     = static_cast<float *>(malloc(max_len * sizeof(float)));
+        UTEST_ASSERT((vImpulse != NULL) && (vZero != NULL) && (vOut[0] != NULL) && (vOut[1] != NULL));
+        lsp_finally {
+            free(vImpulse);
+            free(vZero);
+            free(vOut[0]);
+            free(vOut[1]);
+        };
+        dsp::fill_zero(vZero, BLOCK_SIZE);
+
+        for (const meta::plugin_t * const *meta = variants; *meta != NULL; ++meta)
+        {
+            printf("Testing latency of '%s'...\n", (*meta)->uid);
+            for (size_t i=0; i<sizeof(sample_rates)/sizeof(size_t); ++i)
+                test_variant(*meta, sample_rates[i]);
+        }
+    }
+
+UTEST_END
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t LENGTH          = SAMPLE_RATE;
+    static constexpr size_t BLOCK_SIZE      = 480;          // Not aligned to the internal buffer size
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_stereo,
+        &meta::sc_mb_limiter_stereo,
+        NULL
+    };
+
+    static const size_t ovs_modes[] =
+    {
+        meta::mb_limiter::OVS_NONE,
+        meta::mb_limiter::OVS_TRUE_PEAK_24BIT
+    };
+}
+
+UTEST_BEGIN("mb_limiter", "parallel")
+
+    float *vIn[2];
+    float *vOut[2][2];
+
+    void render(test::PluginHost *host, float **out)
+    {
+        float *in_l     = host->buffer("in_l");
+        float *in_r     = host->buffer("in_r");
+        const float *out_l  = host->buffer("out_l");
+        const float *out_r  = host->buffer("out_r");
+        UTEST_ASSERT((in_l != NULL) && (in_r != NULL) && (out_l != NULL) && (out_r != NULL));
+
+        for (size_t offset=0; offset < LENGTH; )
+        {
+            const size_t to_do  = lsp_min(LENGTH - offset, BLOCK_SIZE);
+            dsp::copy(in_l, &vIn[0][offset], to_do);
+            dsp::copy(in_r, &vIn[1][offset], to_do);
+            host->process(to_do);
+            dsp::copy(&out[0][offset], out_l, to_do);
+            dsp::copy(&out[1][offset], out_r, to_do);
+            offset             += to_do;
+        }
+    }
+
+    void configure(test::PluginHost *host, size_t xover, size_t ovs, bool parallel)
+    {
+        host->reset_ports();
+        host->set("mode", xover);
+        host->set("ovs", ovs);
+        host->set("g_in", 4.0f);            // +12 dB to keep limiters busy
+        host->set("slink", 50.0f);
+        host->set_all("bsl", 50.0f);
+        host->set("mt", (parallel) ? 1.0f : 0.0f);
+    }
+
+    void test_variant(const meta::plugin_t *meta, size_t xover, size_t ovs)
+    {
+        char name[256];
+        snprintf(name, sizeof(name), "%s xover=%d ovs=%d", meta->uid, int(xover), int(ovs));
+        printf("Testing %s...\n", name);
+
+        // Render the same material in serial and parallel mode
+        for (size_t i=0; i<2; ++i)
+        {
+            test::PluginHost host;
+            UTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+            UTEST_ASSERT_MSG(host.has_port("mt"), "No parallel processing switch for %s", meta->uid);
+            configure(&host, xover, ovs, i > 0);
+            render(&host, vOut[i]);
+        }
+
+        // Channels are processed by the same code with their own state, the result should be identical
+        for (size_t ch=0; ch<2; ++ch)
+        {
+            for (size_t i=0; i<LENGTH; ++i)
+            {
+                UTEST_ASSERT_MSG(vOut[0][ch][i] == vOut[1][ch][i],
+                    "Output mismatch for %s at channel %d sample %d: serial=%f, parallel=%f",
+                    name, int(ch), int(i), vOut[0][ch][i], vOut[1][ch][i]);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        float *ptr[6];
+        for (size_t i=0; i<6; ++i)
+        {
+            ptr[i]      = static_cast<float *>(malloc(LENGTH * sizeof(float)));
+            UTEST_ASSERT(ptr[i] != NULL);
+        }
+        lsp_finally {
+            for (size_t i=0; i<6; ++i)
+                free(ptr[i]);
+        };
+
+        vIn[0]      = ptr[0];
+        vIn[1]      = ptr[1];
+        vOut[0][0]  = ptr[2];
+        vOut[0][1]  = ptr[3];
+        vOut[1][0]  = ptr[4];
+        vOut[1][1]  = ptr[5];
+
+        // Different signals in channels to make stereo linking matter
+        test::generate_signal(test::SIG_CORPUS, vIn[0], LENGTH, SAMPLE_RATE, 1);
+        test::generate_transients(vIn[1], LENGTH, SAMPLE_RATE, 2, 1.0f);
+
+        for (const meta::plugin_t * const *meta = variants; *meta != NULL; ++meta)
+            for (size_t xover=0; xover < 2; ++xover)
+                for (size_t i=0; i<sizeof(ovs_modes)/sizeof(size_t); ++i)
+                    test_variant(*meta, xover, ovs_modes[i]);
+    }
+
+UTEST_END
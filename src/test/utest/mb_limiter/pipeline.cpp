@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/PluginHost.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t LENGTH          = SAMPLE_RATE;
+    static constexpr size_t BLOCK_SIZE      = 480;          // Not aligned to the internal buffer size
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        &meta::sc_mb_limiter_mono,
+        &meta::sc_mb_limiter_stereo,
+        NULL
+    };
+
+    static const size_t ovs_modes[] =
+    {
+        meta::mb_limiter::OVS_NONE,
+        meta::mb_limiter::OVS_FULL_8X24BIT
+    };
+
+    static const char *in_ports[]   = { "in_l", "in_r", "in" };
+    static const char *out_ports[]  = { "out_l", "out_r", "out" };
+}
+
+UTEST_BEGIN("mb_limiter", "pipeline")
+
+    float *vIn[2];
+    float *vOut[2][2];
+
+    void render(test::PluginHost *host, float **out, size_t channels)
+    {
+        const char * const *in_id   = (channels > 1) ? &in_ports[0] : &in_ports[2];
+        const char * const *out_id  = (channels > 1) ? &out_ports[0] : &out_ports[2];
+        float *in[2];
+        const float *outp[2];
+
+        for (size_t ch=0; ch<channels; ++ch)
+        {
+            in[ch]      = host->buffer(in_id[ch]);
+            outp[ch]    = host->buffer(out_id[ch]);
+            UTEST_ASSERT((in[ch] != NULL) && (outp[ch] != NULL));
+        }
+
+        for (size_t offset=0; offset < LENGTH; )
+        {
+            const size_t to_do  = lsp_min(LENGTH - offset, BLOCK_SIZE);
+            for (size_t ch=0; ch<channels; ++ch)
+                dsp::copy(in[ch], &vIn[ch][offset], to_do);
+            host->process(to_do);
+            for (size_t ch=0; ch<channels; ++ch)
+                dsp::copy(&out[ch][offset], outp[ch], to_do);
+            offset             += to_do;
+        }
+    }
+
+    void configure(test::PluginHost *host, size_t xover, size_t ovs, bool pipeline)
+    {
+        host->reset_ports();
+        host->set("mode", xover);
+        host->set("ovs", ovs);
+        host->set("g_in", 4.0f);            // +12 dB to keep limiters busy
+        host->set_all("se_", 1.0f);         // All 8 bands
+        host->set_all("bsl", 50.0f);
+        host->set("pipe", (pipeline) ? 1.0f : 0.0f);
+        host->update_settings();
+        host->update_resources();           // The latency is reported once buffers are allocated
+        host->update_settings();
+    }
+
+    void test_variant(const meta::plugin_t *meta, size_t xover, size_t ovs)
+    {
+        char name[256];
+        snprintf(name, sizeof(name), "%s xover=%d ovs=%d", meta->uid, int(xover), int(ovs));
+        printf("Testing %s...\n", name);
+
+        size_t channels = 0;
+        ssize_t latency[2];
+
+        // Render the same material with serial and pipelined processing
+        for (size_t i=0; i<2; ++i)
+        {
+            test::PluginHost host;
+            UTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+            UTEST_ASSERT_MSG(host.has_port("pipe"), "No pipelined processing switch for %s", meta->uid);
+            channels        = (host.has_port("out_r")) ? 2 : 1;
+            configure(&host, xover, ovs, i > 0);
+            latency[i]      = host.latency();
+            render(&host, vOut[i], channels);
+        }
+
+        // Pipelined processing adds latency and does not change the processing itself
+        const ssize_t delay = latency[1] - latency[0];
+        UTEST_ASSERT_MSG(delay > 0, "Pipelined mode does not report additional latency for %s", name);
+        for (size_t ch=0; ch<channels; ++ch)
+        {
+            for (size_t i=0; i<size_t(delay); ++i)
+                UTEST_ASSERT_MSG(vOut[1][ch][i] == 0.0f,
+                    "Non-zero pipeline head for %s at channel %d sample %d: %f",
+                    name, int(ch), int(i), vOut[1][ch][i]);
+
+            for (size_t i=delay; i<LENGTH; ++i)
+            {
+                UTEST_ASSERT_MSG(vOut[0][ch][i - delay] == vOut[1][ch][i],
+                    "Output mismatch for %s at channel %d sample %d: serial=%f, pipelined=%f",
+                    name, int(ch), int(i), vOut[0][ch][i - delay], vOut[1][ch][i]);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        float *ptr[6];
+        for (size_t i=0; i<6; ++i)
+        {
+            ptr[i]      = static_cast<float *>(malloc(LENGTH * sizeof(float)));
+            UTEST_ASSERT(ptr[i] != NULL);
+        }
+        lsp_finally {
+            for (size_t i=0; i<6; ++i)
+                free(ptr[i]);
+        };
+
+        vIn[0]      = ptr[0];
+        vIn[1]      = ptr[1];
+        vOut[0][0]  = ptr[2];
+        vOut[0][1]  = ptr[3];
+        vOut[1][0]  = ptr[4];
+        vOut[1][1]  = ptr[5];
+
+        test::generate_signal(test::SIG_CORPUS, vIn[0], LENGTH, SAMPLE_RATE, 1);
+        test::generate_transients(vIn[1], LENGTH, SAMPLE_RATE, 2, 1.0f);
+
+        for (const meta::plugin_t * const *meta = variants; *meta != NULL; ++meta)
+            for (size_t xover=0; xover < 2; ++xover)
+                for (size_t i=0; i<sizeof(ovs_modes)/sizeof(size_t); ++i)
+                    test_variant(*meta, xover, ovs_modes[i]);
+    }
+
+UTEST_END
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/meta/mb_limiter.h>
+#include <private/test/PluginHost.h>
+#include <private/test/rtcheck.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLE_RATE     = 48000;
+    static constexpr size_t BLOCK_SIZE      = 256;
+    static constexpr size_t BLOCKS_PER_STEP = 4;
+
+    enum step_flags_t
+    {
+        SF_PREFIX       = 1 << 0,   // Identifier is a prefix, change all matching ports
+        SF_SC           = 1 << 1    // Step is applicable only to sidechain versions
+    };
+
+    typedef struct step_t
+    {
+        const char *id;         // Port identifier or prefix of identifiers
+        float       value;      // Value to set
+        size_t      flags;      // Step flags
+    } step_t;
+
+    static const meta::plugin_t *variants[] =
+    {
+        &meta::mb_limiter_mono,
+        &meta::mb_limiter_stereo,
+        &meta::sc_mb_limiter_mono,
+        &meta::sc_mb_limiter_stereo,
+        NULL
+    };
+
+    // Sequence of parameter changes applied one by one, each change is followed
+    // by update_settings() and several process() calls with the checker armed.
+    // Resources requested by update_settings() are allocated in between with the
+    // checker disarmed, like the executor of the wrapper does
+    static const step_t common_steps[] =
+    {
+        // Processing modes, threads are started by update_resources() on the first use.
+        // Parallel processing of bands stays enabled for the rest of steps
+        { "mt", 1.0f, 0 }, { "pipe", 1.0f, 0 }, { "mt", 0.0f, 0 }, { "pipe", 0.0f, 0 },
+        { "tile", 1.0f, 0 }, { "tile", 0.0f, 0 }, { "bmt", 1.0f, 0 },
+
+        // Split toggles in classic mode
+        { "se_1", 1.0f, 0 }, { "se_2", 0.0f, 0 }, { "se_3", 1.0f, 0 }, { "se_4", 0.0f, 0 },
+        { "se_5", 1.0f, 0 }, { "se_6", 1.0f, 0 }, { "se_7", 1.0f, 0 },
+        { "sf_1", 60.0f, 0 }, { "sf_3", 12000.0f, 0 }, { "sf_5", 500.0f, 0 },
+        { "se_", 0.0f, SF_PREFIX }, { "se_", 1.0f, SF_PREFIX },
+
+        // Crossover mode switches
+        { "mode", 1.0f, 0 }, { "se_2", 0.0f, 0 }, { "sf_4", 2000.0f, 0 }, { "se_", 0.0f, SF_PREFIX },
+        { "se_", 1.0f, SF_PREFIX }, { "mode", 0.0f, 0 }, { "mode", 1.0f, 0 },
+
+        // Lookahead, limiter modes and sidechain
+        { "lk", meta::mb_limiter::LOOKAHEAD_MIN, 0 }, { "lk", meta::mb_limiter::LOOKAHEAD_MAX, 0 },
+        { "lm", meta::mb_limiter::LOM_EXP_WIDE, SF_PREFIX }, { "lm", meta::mb_limiter::LOM_LINE_DUCK, SF_PREFIX },
+        { "alr", 1.0f, SF_PREFIX }, { "alr", 0.0f, SF_PREFIX }, { "on", 0.0f, SF_PREFIX }, { "on", 1.0f, SF_PREFIX },
+        { "extsc", 1.0f, 0 }, { "extsc", 0.0f, 0 }, { "dither", 4.0f, 0 }, { "dither", 0.0f, 0 },
+        { "envb", 2.0f, 0 }, { "react", 1000.0f, 0 },
+
+        // Solo and mute
+        { "bs_2", 1.0f, 0 }, { "bm_3", 1.0f, 0 }, { "bs_2", 0.0f, 0 }, { "bm_3", 0.0f, 0 },
+
+        // Analyzer
+        { "ife", 0.0f, SF_PREFIX }, { "ofe", 0.0f, SF_PREFIX }, { "ife", 1.0f, SF_PREFIX }, { "ofe", 1.0f, SF_PREFIX },
+
+        // Premix
+        { "in2lk", GAIN_AMP_0_DB, 0 }, { "lk2in", GAIN_AMP_0_DB, 0 }, { "lk2sc", GAIN_AMP_0_DB, 0 },
+        { "in2sc", GAIN_AMP_0_DB, 0 }, { "sc2in", GAIN_AMP_0_DB, 0 }, { "sc2lk", GAIN_AMP_0_DB, 0 },
+        { "extsc", 2.0f, SF_SC },
+
+        // Bypass
+        { "bypass", 1.0f, 0 }, { "bypass", 0.0f, 0 },
+
+        { NULL, 0.0f, 0 }
+    };
+}
+
+UTEST_BEGIN("mb_limiter", "rt_safety")
+
+    float *vSignal;
+    size_t nOffset;
+
+    void run_blocks(test::PluginHost *host)
+    {
+        for (size_t i=0; i<BLOCKS_PER_STEP; ++i)
+        {
+            host->fill_inputs(&vSignal[nOffset], BLOCK_SIZE);
+            host->process(BLOCK_SIZE);
+            nOffset     = (nOffset + BLOCK_SIZE) % SAMPLE_RATE;
+        }
+    }
+
+    void check_step(test::PluginHost *host, const char *name)
+    {
+        test::rt_check_begin("update_settings()");
+        host->update_settings();
+        test::rt_check_end();
+
+        host->update_resources();
+
+        test::rt_check_begin("process()");
+        run_blocks(host);
+        test::rt_check_end();
+
+        test::rt_check_begin("ui_activated()");
+        host->module()->ui_activated();
+        test::rt_check_end();
+
+        const size_t violations = test::rt_check_violations();
+        UTEST_ASSERT_MSG(violations == 0,
+            "Detected %d real-time safety violations (%d allocations, %d locks, %d syscalls) "
+            "after step '%s' for plugin '%s', first: %s",
+            int(violations),
+            int(test::rt_check_violations(test::RT_ALLOC)),
+            int(test::rt_check_violations(test::RT_LOCK)),
+            int(test::rt_check_violations(test::RT_SYSCALL)),
+            name, host->metadata()->uid, test::rt_check_first_violation());
+    }
+
+    void test_variant(const meta::plugin_t *meta)
+    {
+        char name[64];
+        printf("Testing real-time safety of '%s'...\n", meta->uid);
+
+        // Instantiation and sample rate change are not real-time operations
+        test::PluginHost host;
+        UTEST_ASSERT(host.init(meta, SAMPLE_RATE, BLOCK_SIZE) == STATUS_OK);
+        host.set("g_in", GAIN_AMP_P_6_DB);
+        test::rt_check_reset();
+
+        check_step(&host, "initial");
+
+        // Walk through all parameter changes
+        for (const step_t *s = common_steps; s->id != NULL; ++s)
+        {
+            if ((s->flags & SF_SC) && (!host.has_port("sc")) && (!host.has_port("sc_l")))
+                continue;
+            if (s->flags & SF_PREFIX)
+            {
+                if (host.set_all(s->id, s->value) <= 0)
+                    continue;
+            }
+            else if (!host.set(s->id, s->value))
+                continue;
+            snprintf(name, sizeof(name), "%s=%g", s->id, s->value);
+            check_step(&host, name);
+        }
+
+        // All oversampling modes in both crossover modes
+        for (size_t mode=0; mode<2; ++mode)
+        {
+            host.set("mode", mode);
+            for (size_t ovs=0; ovs <= meta::mb_limiter::OVS_TRUE_PEAK_24BIT; ++ovs)
+            {
+                host.set("ovs", ovs);
+                snprintf(name, sizeof(name), "mode=%d, ovs=%d", int(mode), int(ovs));
+                check_step(&host, name);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        if (!test::rt_check_supported())
+        {
+            printf("Real-time safety checker is not supported on this platform, skipping\n");
+            return;
+        }
+
+        vSignal     = static_cast<float *>(malloc(SAMPLE_RATE * sizeof(float)));
+        UTEST_ASSERT(vSignal != NULL);
+        lsp_finally { free(vSignal); };
+        test::generate_signal(test::SIG_CORPUS, vSignal, SAMPLE_RATE, SAMPLE_RATE, 0x1234);
+        nOffset     = 0;
+
+        for (const meta::plugin_t * const *meta = variants; *meta != NULL; ++meta)
+            test_variant(*meta);
+    }
+
+UTEST_END
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <stdlib.h>
+
+#include <private/plugins/mb_limiter.h>
+#include <private/test/signal.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t LENGTH          = 0x1003;       // Not aligned to the vector size
+    static constexpr float TOLERANCE        = 1e-6f;
+}
+
+UTEST_BEGIN("mb_limiter", "stereo_link")
+
+    void check(const float *l, const float *r, float link)
+    {
+        float *ptr[5];
+        for (size_t i=0; i<5; ++i)
+        {
+            ptr[i]      = static_cast<float *>(malloc(LENGTH * 2 * sizeof(float)));
+            UTEST_ASSERT(ptr[i] != NULL);
+        }
+        lsp_finally {
+            for (size_t i=0; i<5; ++i)
+                free(ptr[i]);
+        };
+
+        float *rl = ptr[0], *rr = ptr[1], *vl = ptr[2], *vr = ptr[3];
+        dsp::copy(rl, l, LENGTH);
+        dsp::copy(rr, r, LENGTH);
+        dsp::copy(vl, l, LENGTH);
+        dsp::copy(vr, r, LENGTH);
+
+        // Reference: the lower gain stays, the higher gain moves towards it
+        for (size_t i=0; i<LENGTH; ++i)
+        {
+            if (rl[i] < rr[i])
+                rr[i]       = rr[i] + (rl[i] - rr[i]) * link;
+            else
+                rl[i]       = rl[i] + (rr[i] - rl[i]) * link;
+        }
+
+        plugins::mb_limiter::perform_stereo_link(vl, vr, ptr[4], link, LENGTH);
+
+        for (size_t i=0; i<LENGTH; ++i)
+        {
+            // The lower gain should not change at all
+            if (l[i] <= r[i])
+                UTEST_ASSERT_MSG(vl[i] == l[i], "Left gain changed at sample %d: %f -> %f", int(i), l[i], vl[i]);
+            if (r[i] <= l[i])
+                UTEST_ASSERT_MSG(vr[i] == r[i], "Right gain changed at sample %d: %f -> %f", int(i), r[i], vr[i]);
+
+            UTEST_ASSERT_MSG((fabsf(vl[i] - rl[i]) <= TOLERANCE) && (fabsf(vr[i] - rr[i]) <= TOLERANCE),
+                "Mismatch at sample %d link=%f: expected (%f, %f), got (%f, %f)",
+                int(i), link, rl[i], rr[i], vl[i], vr[i]);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        float *l    = static_cast<float *>(malloc(LENGTH * sizeof(float)));
+        float *r    = static_cast<float *>(malloc(LENGTH * sizeof(float)));
+        UTEST_ASSERT((l != NULL) && (r != NULL));
+        lsp_finally {
+            free(l);
+            free(r);
+        };
+
+        // Random gains in range [0, 1] with some equal samples
+        test::generate_noise(l, LENGTH, 1, 0.5f);
+        test::generate_noise(r, LENGTH, 2, 0.5f);
+        dsp::add_k2(l, 0.5f, LENGTH);
+        dsp::add_k2(r, 0.5f, LENGTH);
+        for (size_t i=0; i<LENGTH; i += 7)
+            r[i]        = l[i];
+
+        for (size_t i=0; i<=4; ++i)
+            check(l, r, i * 0.25f);
+    }
+
+UTEST_END
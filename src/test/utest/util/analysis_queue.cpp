@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/util/AnalysisQueue.h>
+
+UTEST_BEGIN("mb_limiter.util", "analysis_queue")
+
+    void test_ring()
+    {
+        plugins::SampleRing ring;
+        float src[2][12], dst[2][16];
+        const float *in[2]  = { src[0], NULL };
+        float *out[2]       = { dst[0], dst[1] };
+
+        UTEST_ASSERT(ring.init(2, 5) == STATUS_OK);    // Rounded up to 8 samples
+        UTEST_ASSERT(ring.lanes() == 2);
+        UTEST_ASSERT(ring.capacity() == 8);
+        UTEST_ASSERT(ring.space() == 8);
+
+        for (size_t i=0; i<12; ++i)
+        {
+            src[0][i]   = i + 1;
+            src[1][i]   = -float(i + 1);
+        }
+
+        // Overflow the ring, the second lane is silent
+        UTEST_ASSERT(ring.write(in, 10) == 8);
+        UTEST_ASSERT(ring.pending() == 8);
+        UTEST_ASSERT(ring.space() == 0);
+        UTEST_ASSERT(ring.dropped() == 2);
+
+        // Read part of samples
+        UTEST_ASSERT(ring.read(out, 5) == 5);
+        for (size_t i=0; i<5; ++i)
+        {
+            UTEST_ASSERT(dst[0][i] == float(i + 1));
+            UTEST_ASSERT(dst[1][i] == 0.0f);
+        }
+
+        // Wrap around the end of the ring
+        in[1]       = src[1];
+        UTEST_ASSERT(ring.write(in, 5) == 5);
+        UTEST_ASSERT(ring.dropped() == 2);
+        UTEST_ASSERT(ring.read(out, 16) == 8);
+        for (size_t i=0; i<3; ++i)
+        {
+            UTEST_ASSERT(dst[0][i] == float(i + 6));
+            UTEST_ASSERT(dst[1][i] == 0.0f);
+        }
+        for (size_t i=3; i<8; ++i)
+        {
+            UTEST_ASSERT(dst[0][i] == float(i - 2));
+            UTEST_ASSERT(dst[1][i] == -float(i - 2));
+        }
+        UTEST_ASSERT(ring.pending() == 0);
+        UTEST_ASSERT(ring.space() == 8);
+        UTEST_ASSERT(ring.read(out, 16) == 0);
+    }
+
+    void test_frames()
+    {
+        plugins::FrameBuffer fb;
+
+        UTEST_ASSERT(fb.init(4) == STATUS_OK);
+        UTEST_ASSERT(fb.size() == 4);
+
+        // Initially the frame is empty
+        const float *front  = fb.front();
+        UTEST_ASSERT(front != NULL);
+        for (size_t i=0; i<4; ++i)
+            UTEST_ASSERT(front[i] == 0.0f);
+
+        // The consumer gets the latest published frame
+        for (size_t k=1; k<=3; ++k)
+        {
+            float *back         = fb.back();
+            for (size_t i=0; i<4; ++i)
+                back[i]             = k * 10 + i;
+            fb.publish();
+        }
+
+        front               = fb.front();
+        for (size_t i=0; i<4; ++i)
+            UTEST_ASSERT(front[i] == float(30 + i));
+
+        // The frame is kept until the new one is published
+        front               = fb.front();
+        for (size_t i=0; i<4; ++i)
+            UTEST_ASSERT(front[i] == float(30 + i));
+
+        // Producer never writes to the frame owned by consumer
+        float *back         = fb.back();
+        UTEST_ASSERT(back != front);
+        back[0]             = 40.0f;
+        fb.publish();
+        UTEST_ASSERT(front[0] == 30.0f);
+        UTEST_ASSERT(fb.front()[0] == 40.0f);
+    }
+
+    UTEST_MAIN
+    {
+        test_ring();
+        test_frames();
+    }
+
+UTEST_END
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/util/EventTrace.h>
+
+UTEST_BEGIN("mb_limiter.util", "event_trace")
+
+    void test_ring()
+    {
+        plugins::EventTrace trace;
+        plugins::trace_record_t buf[16];
+
+        UTEST_ASSERT(trace.init(5) == STATUS_OK);   // Rounded up to 8 records
+
+        // Fill the ring and overflow it
+        for (size_t i=0; i<10; ++i)
+        {
+            trace.begin_block();
+            const bool recorded = trace.record(plugins::TE_LATENCY, i);
+            UTEST_ASSERT(recorded == (i < 8));
+            trace.end_block(64);
+        }
+        UTEST_ASSERT(trace.pending() == 8);
+        UTEST_ASSERT(trace.dropped() == 2);
+
+        // Read part of records
+        UTEST_ASSERT(trace.read(buf, 3) == 3);
+        for (size_t i=0; i<3; ++i)
+        {
+            UTEST_ASSERT(buf[i].nType == plugins::TE_LATENCY);
+            UTEST_ASSERT(buf[i].nArg == i);
+            UTEST_ASSERT(buf[i].nBlock == i + 1);
+            UTEST_ASSERT(buf[i].nSample == i * 64);
+        }
+
+        // Wrap around the end of the ring
+        for (size_t i=0; i<3; ++i)
+            UTEST_ASSERT(trace.record(plugins::TE_OVERRUN, 100 + i));
+        UTEST_ASSERT(!trace.record(plugins::TE_OVERRUN, 0));
+
+        UTEST_ASSERT(trace.read(buf, 16) == 8);
+        for (size_t i=0; i<5; ++i)
+            UTEST_ASSERT(buf[i].nArg == i + 3);
+        for (size_t i=5; i<8; ++i)
+        {
+            UTEST_ASSERT(buf[i].nType == plugins::TE_OVERRUN);
+            UTEST_ASSERT(buf[i].nArg == 100 + i - 5);
+        }
+        UTEST_ASSERT(trace.pending() == 0);
+    }
+
+    void test_drain()
+    {
+        plugins::EventTrace trace;
+        char path[1024], line[256];
+
+        UTEST_ASSERT(trace.init(16) == STATUS_OK);
+        trace.begin_block();
+        UTEST_ASSERT(trace.record(plugins::TE_PLAN_REBUILD, 4));
+        trace.end_block(128);
+        trace.begin_block();
+        UTEST_ASSERT(trace.record(plugins::TE_DELAY_CLEAR, plugins::TD_DRY));
+
+        snprintf(path, sizeof(path), "%s/utest-%s.log", tempdir(), full_name());
+        remove(path);
+        UTEST_ASSERT(trace.drain(path) == STATUS_OK);
+        UTEST_ASSERT(trace.pending() == 0);
+
+        FILE *fd = fopen(path, "r");
+        UTEST_ASSERT(fd != NULL);
+        UTEST_ASSERT(fgets(line, sizeof(line), fd) != NULL);
+        UTEST_ASSERT(strcmp(line, "block=1 sample=0 event=plan_rebuild arg=4\n") == 0);
+        UTEST_ASSERT(fgets(line, sizeof(line), fd) != NULL);
+        UTEST_ASSERT(strcmp(line, "block=2 sample=128 event=delay_clear arg=4\n") == 0);
+        UTEST_ASSERT(fgets(line, sizeof(line), fd) == NULL);
+        fclose(fd);
+    }
+
+    UTEST_MAIN
+    {
+        test_ring();
+        test_drain();
+    }
+
+UTEST_END
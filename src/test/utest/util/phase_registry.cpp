@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-limiter
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-mb-limiter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-limiter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-limiter. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/util/PhaseRegistry.h>
+
+UTEST_BEGIN("mb_limiter.util", "phase_registry")
+
+    UTEST_MAIN
+    {
+        static constexpr size_t COUNT = 40;
+        ssize_t slots[COUNT];
+        float phases[COUNT];
+
+        const size_t before = plugins::PhaseRegistry::acquired();
+        UTEST_ASSERT(plugins::PhaseRegistry::phase(-1) == 0.0f);
+
+        // Acquire slots for many instances
+        for (size_t i=0; i<COUNT; ++i)
+        {
+            slots[i]    = plugins::PhaseRegistry::acquire();
+            UTEST_ASSERT(slots[i] >= 0);
+            phases[i]   = plugins::PhaseRegistry::phase(slots[i]);
+            UTEST_ASSERT((phases[i] >= 0.0f) && (phases[i] < 1.0f));
+            for (size_t j=0; j<i; ++j)
+            {
+                UTEST_ASSERT(slots[i] != slots[j]);
+                UTEST_ASSERT(phases[i] != phases[j]);
+            }
+        }
+        UTEST_ASSERT(plugins::PhaseRegistry::acquired() == before + COUNT);
+
+        // The first slots cover the period uniformly
+        UTEST_ASSERT(plugins::PhaseRegistry::phase(0) == 0.0f);
+        UTEST_ASSERT(plugins::PhaseRegistry::phase(1) == 0.5f);
+        UTEST_ASSERT(plugins::PhaseRegistry::phase(2) == 0.25f);
+        UTEST_ASSERT(plugins::PhaseRegistry::phase(3) == 0.75f);
+
+        // Released slot is reused
+        const ssize_t released = slots[COUNT / 2];
+        plugins::PhaseRegistry::release(released);
+        UTEST_ASSERT(plugins::PhaseRegistry::acquired() == before + COUNT - 1);
+        slots[COUNT / 2]    = plugins::PhaseRegistry::acquire();
+        UTEST_ASSERT(slots[COUNT / 2] == released);
+
+        for (size_t i=0; i<COUNT; ++i)
+            plugins::PhaseRegistry::release(slots[i]);
+        UTEST_ASSERT(plugins::PhaseRegistry::acquired() == before);
+    }
+
+UTEST_END